@@ -0,0 +1,129 @@
+#include "../src/list.h"
+
+#include <time.h>
+
+/* Default number of elements in the list */
+#define NUM 1000000
+
+/* Number of passes */
+#define RUNS 20
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+static void add(Data data, void* sum) {
+    *((long*) sum) += *((int*) data);
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    List_t list = NULL;
+
+    int* values = NULL;
+
+    Data* array = NULL;
+
+    long sum = 0;
+
+    double start = 0;
+
+    /* ================================ */
+
+
+
+    srand(1);
+
+    values = (int*) malloc(num * sizeof(int));
+
+    for (size_t i = 0; i < num; i++) {
+        values[i] = rand() % 1000;
+    }
+
+    /* Values stored in the nodes */
+    list = List_from_values(NULL, NULL, NULL, values, sizeof(int), num);
+
+    array = (Data*) malloc(num * sizeof(Data));
+
+    printf("elements: %lu, ms per pass\n", num);
+
+    /* ================ Sum through a callback per node =============== */
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        sum = 0;
+
+        List_for_each(list, add, &sum);
+    }
+
+    printf("%-32s %10.3f  (%ld)\n", "List_for_each", (now() - start) / RUNS * 1e3, sum);
+
+    /* ============ Snapshot the pointers, sum over the array ========= */
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        sum = 0;
+
+        List_to_array(list, array, num);
+
+        for (size_t j = 0; j < num; j++) {
+            sum += *((int*) array[j]);
+        }
+    }
+
+    printf("%-32s %10.3f  (%ld)\n", "List_to_array + loop", (now() - start) / RUNS * 1e3, sum);
+
+    /* ======== Copy the values out, sum with a vectorized loop ======= */
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        sum = 0;
+
+        List_copy_values(list, values, sizeof(int), num);
+
+        for (size_t j = 0; j < num; j++) {
+            sum += values[j];
+        }
+    }
+
+    printf("%-32s %10.3f  (%ld)\n", "List_copy_values + loop", (now() - start) / RUNS * 1e3, sum);
+
+    /* ============= Summing an existing copy again ================== */
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        sum = 0;
+
+        for (size_t j = 0; j < num; j++) {
+            sum += values[j];
+        }
+    }
+
+    printf("%-32s %10.3f  (%ld)\n", "loop over the copy", (now() - start) / RUNS * 1e3, sum);
+
+    List_destroy(&list);
+
+    free(array);
+
+    free(values);
+
+    /* ================================ */
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
@@ -0,0 +1,154 @@
+#include "../src/list.h"
+#include "../src/cqueue/cqueue.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+/* Default number of elements every producer enqueues */
+#define OPS 500000
+
+/* Largest number of producer/consumer pairs */
+#define MAX_PAIRS 8
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+static size_t ops = OPS;
+
+static CQueue_t queue = NULL;
+
+static List_t list = NULL;
+
+static pthread_mutex_t list_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Number of elements consumed so far by all consumers */
+static atomic_size_t consumed;
+
+/* Total number of elements to consume */
+static size_t total = 0;
+
+/* ================================================================ */
+
+static void* cqueue_producer(void* arg) {
+
+    (void) arg;
+
+    for (size_t i = 0; i < ops; i++) {
+        CQueue_enqueue(queue, (Data) (uintptr_t) (i + 1));
+    }
+
+    return NULL;
+}
+
+static void* cqueue_consumer(void* arg) {
+    Data data = NULL;
+
+    (void) arg;
+
+    while (atomic_load(&consumed) < total) {
+
+        if (CQueue_dequeue(queue, &data) == 0) {
+            atomic_fetch_add(&consumed, 1);
+        }
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+static void* list_producer(void* arg) {
+
+    (void) arg;
+
+    for (size_t i = 0; i < ops; i++) {
+        pthread_mutex_lock(&list_lock);
+
+        List_insert_last(list, (Data) (uintptr_t) (i + 1));
+
+        pthread_mutex_unlock(&list_lock);
+    }
+
+    return NULL;
+}
+
+static void* list_consumer(void* arg) {
+    int removed = 0;
+
+    (void) arg;
+
+    while (atomic_load(&consumed) < total) {
+        pthread_mutex_lock(&list_lock);
+
+        removed = (List_remove_first(list) == 0);
+
+        pthread_mutex_unlock(&list_lock);
+
+        if (removed) {
+            atomic_fetch_add(&consumed, 1);
+        }
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+/**
+ * Run producer/consumer pairs and return the number of transferred elements per second.
+*/
+static double run(size_t pairs, void* (*producer)(void*), void* (*consumer)(void*)) {
+    pthread_t threads[2 * MAX_PAIRS];
+
+    double start = 0;
+
+    total = pairs * ops;
+
+    atomic_store(&consumed, 0);
+
+    start = now();
+
+    for (size_t i = 0; i < pairs; i++) {
+        pthread_create(&threads[2 * i], NULL, producer, NULL);
+        pthread_create(&threads[2 * i + 1], NULL, consumer, NULL);
+    }
+
+    for (size_t i = 0; i < 2 * pairs; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    return total / (now() - start);
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+
+    ops = (argc > 1) ? strtoul(argv[1], NULL, 10) : OPS;
+
+    queue = CQueue_create(NULL);
+    list = List_create(NULL, NULL, NULL);
+
+    printf("%-6s %16s %16s\n", "pairs", "CQueue ops/s", "mutex List ops/s");
+
+    for (size_t pairs = 1; pairs <= MAX_PAIRS; pairs *= 2) {
+        printf("%-6lu %16.0f %16.0f\n", pairs, run(pairs, cqueue_producer, cqueue_consumer), run(pairs, list_producer, list_consumer));
+    }
+
+    CQueue_destroy(&queue);
+    List_destroy(&list);
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
@@ -0,0 +1,92 @@
+#include "../src/list.h"
+
+#include <time.h>
+
+/* Default number of insert/remove pairs */
+#define NUM 10000000
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+/**
+ * Time pairs of an insertion and a removal on a short pooled list, so the node memory stays in cache
+ * and the bookkeeping around it (checks, scrubbing) is what gets measured. Built twice by the makefile:
+ * bench_diagnostics.out with the default flags and bench_diagnostics_off.out with LIST_NO_DIAGNOSTICS
+ * and LIST_NO_SCRUB.
+*/
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of insert/remove pairs */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    List_t list = NULL;
+
+    int value = 1;
+
+    double start = 0;
+
+    /* ================================ */
+
+
+
+#if defined(LIST_NO_DIAGNOSTICS) && defined(LIST_NO_SCRUB)
+    printf("build: LIST_NO_DIAGNOSTICS LIST_NO_SCRUB, %lu pairs, ns per pair\n", num);
+#else
+    printf("build: default, %lu pairs, ns per pair\n", num);
+#endif
+
+    list = List_create_pooled(NULL, NULL, NULL, NULL);
+
+    /* A few nodes so removals never empty the list */
+    for (int i = 0; i < 8; i++) {
+        List_insert_first(list, &value);
+    }
+
+    start = now();
+
+    for (size_t i = 0; i < num; i++) {
+        List_insert_first(list, &value);
+
+        List_remove_first(list);
+    }
+
+    printf("%-30s %8.2f\n", "insert_first + remove_first", (now() - start) / num * 1e9);
+
+    start = now();
+
+    for (size_t i = 0; i < num; i++) {
+        List_insert_last(list, &value);
+
+        List_remove_first(list);
+    }
+
+    printf("%-30s %8.2f\n", "insert_last + remove_first", (now() - start) / num * 1e9);
+
+    start = now();
+
+    for (size_t i = 0; i < num; i++) {
+        List_insert_first_value(list, &value, sizeof(int));
+
+        List_remove_first(list);
+    }
+
+    printf("%-30s %8.2f\n", "insert_first_value + remove", (now() - start) / num * 1e9);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
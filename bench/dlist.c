@@ -0,0 +1,84 @@
+#include "../src/list.h"
+#include "../src/dlist/dlist.h"
+
+#include <stdint.h>
+#include <time.h>
+
+/* Default number of elements in the lists */
+#define NUM 1000000
+
+/* Number of List_remove_last calls measured on the singly linked list */
+#define POPS 200
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    /* Number of measured pops of the singly linked list */
+    size_t pops = (num < POPS) ? num : POPS;
+
+    List_t list = NULL;
+
+    DList_t dlist = NULL;
+
+    double start = 0;
+
+    double list_pop = 0;
+
+    double dlist_pop = 0;
+
+    /* ================================ */
+
+
+
+    list = List_create(NULL, NULL, NULL);
+    dlist = DList_create(NULL, NULL, NULL);
+
+    for (size_t i = 0; i < num; i++) {
+        List_insert_last(list, (Data) (uintptr_t) i);
+        DList_insert_last(dlist, (Data) (uintptr_t) i);
+    }
+
+    /* Draining the singly linked list completely is O(n^2), so only a few pops are timed */
+    start = now();
+
+    for (size_t i = 0; i < pops; i++) {
+        List_remove_last(list);
+    }
+
+    list_pop = (now() - start) / pops;
+
+    /* The doubly linked list is drained completely */
+    start = now();
+
+    while (dlist->size > 0) {
+        DList_remove_last(dlist);
+    }
+
+    dlist_pop = (now() - start) / num;
+
+    printf("elements: %lu\n", num);
+    printf("List_remove_last:  %12.1f ns/pop, full drain ~%.3f s (estimated)\n", list_pop * 1e9, list_pop * num / 2);
+    printf("DList_remove_last: %12.1f ns/pop, full drain  %.3f s\n", dlist_pop * 1e9, dlist_pop * num);
+
+    List_destroy(&list);
+    DList_destroy(&dlist);
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
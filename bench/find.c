@@ -0,0 +1,107 @@
+#include "../src/list.h"
+
+#include <time.h>
+
+/* Default number of elements in the list */
+#define NUM 1000000
+
+/* Number of searches */
+#define RUNS 20
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    /* Key that is not in the list, so every search is a full scan */
+    int missing = -1;
+
+    List_t list = NULL;
+
+    Node_t node = NULL;
+
+    int* x = NULL;
+
+    double start = 0;
+
+    /* ================================ */
+
+
+
+    list = List_create(free, NULL, int_match);
+
+    for (size_t i = 0; i < num; i++) {
+        x = (int*) malloc(sizeof(int));
+
+        *x = (int) i;
+
+        List_insert_last(list, x);
+    }
+
+    printf("elements: %lu, ms per full scan\n", num);
+
+    /* ================================ */
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        node = List_find(list, &missing, NULL);
+    }
+
+    printf("List_find + int_match: %8.3f\n", (now() - start) / RUNS * 1e3);
+
+    /* ================================ */
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        node = List_find_int(list, missing);
+    }
+
+    printf("List_find_int:         %8.3f\n", (now() - start) / RUNS * 1e3);
+
+    /* ================================ */
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        List_find_if(list, node, *((int*) node->data) == missing) ;
+    }
+
+    printf("List_find_if:          %8.3f\n", (now() - start) / RUNS * 1e3);
+
+    /* ================================ */
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        List_count(list, &missing, NULL);
+    }
+
+    printf("List_count:            %8.3f\n", (now() - start) / RUNS * 1e3);
+
+    List_destroy(&list);
+
+    return (node == NULL) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* ================================================================ */
@@ -0,0 +1,102 @@
+#include "../src/list.h"
+
+#include <time.h>
+
+/* Default number of elements in the list */
+#define NUM 1000000
+
+/* Number of searches */
+#define RUNS 20
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+/* ================================================================ */
+
+/**
+ * Fill a list with ints, either boxed in their own allocation or stored in the nodes, then time it.
+*/
+static void run(const char* name, int inline_values) {
+    /* =========== VARIABLES ========== */
+
+    /* Key that is not in the list, so every search is a full scan */
+    int missing = -1;
+
+    List_t list = NULL;
+
+    int* x = NULL;
+
+    double start = 0;
+
+    double insert = 0;
+
+    double find = 0;
+
+    /* ================================ */
+
+
+
+    start = now();
+
+    list = List_create(free, NULL, int_match);
+
+    for (int i = 0; i < NUM; i++) {
+
+        if (inline_values) {
+            List_insert_last_value(list, &i, sizeof(int));
+        }
+        else {
+            x = (int*) malloc(sizeof(int));
+
+            *x = i;
+
+            List_insert_last(list, x);
+        }
+    }
+
+    insert = now() - start;
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        List_find(list, &missing, NULL);
+    }
+
+    find = (now() - start) / RUNS;
+
+    start = now();
+
+    List_destroy(&list);
+
+    printf("%-8s %10.3f %10.3f %10.3f\n", name, insert * 1e3, find * 1e3, (now() - start) * 1e3);
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    printf("elements: %d, ms\n", NUM);
+
+    printf("%-8s %10s %10s %10s\n", "ints", "insert", "find", "destroy");
+
+    run("boxed", 0);
+
+    run("inline", 1);
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
@@ -0,0 +1,116 @@
+#include "../src/list.h"
+
+#include <time.h>
+
+/* Default number of elements in every list */
+#define NUM 100000
+
+/* Number of lists merged */
+#define LISTS 16
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_order(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) > *((int*) data_2)) - (*((int*) data_1) < *((int*) data_2));
+}
+
+/* ================================================================ */
+
+/**
+ * Fill lists with increasing timestamps, like logs of several sources covering the same period.
+*/
+static void fill(List_t* lists, size_t num) {
+    /* Timestamp of every list */
+    int time[LISTS] = { 0 };
+
+    int* x = NULL;
+
+    for (size_t i = 0; i < LISTS; i++) {
+
+        lists[i] = List_create(free, NULL, int_order);
+
+        for (size_t j = 0; j < num; j++) {
+            x = (int*) malloc(sizeof(int));
+
+            *x = (time[i] += rand() % 100);
+
+            List_insert_last(lists[i], x);
+        }
+    }
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements in every list */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    List_t lists[LISTS];
+
+    double start = 0;
+
+    /* ================================ */
+
+
+
+    srand(1);
+
+    printf("lists: %d x %lu elements, ms\n", LISTS, num);
+
+    /* ============ Concatenate, then sort everything again =========== */
+    fill(lists, num);
+
+    start = now();
+
+    for (size_t i = 1; i < LISTS; i++) {
+        List_merge(&lists[0], &lists[i]);
+    }
+
+    List_sort(lists[0], NULL);
+
+    printf("%-24s %10.3f\n", "List_merge + List_sort", (now() - start) * 1e3);
+
+    List_destroy(&lists[0]);
+
+    /* ==================== Merge all lists at once =================== */
+    fill(lists, num);
+
+    start = now();
+
+    List_merge_sorted_n(&lists[0], lists + 1, LISTS - 1, NULL);
+
+    printf("%-24s %10.3f\n", "List_merge_sorted_n", (now() - start) * 1e3);
+
+    List_destroy(&lists[0]);
+
+    /* ===================== Merge lists pairwise ===================== */
+    fill(lists, num);
+
+    start = now();
+
+    for (size_t i = 1; i < LISTS; i++) {
+        List_merge_sorted(&lists[0], &lists[i], NULL);
+    }
+
+    printf("%-24s %10.3f\n", "List_merge_sorted", (now() - start) * 1e3);
+
+    List_destroy(&lists[0]);
+
+    /* ================================ */
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
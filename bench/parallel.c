@@ -0,0 +1,109 @@
+#include "../src/list.h"
+#include "../src/parallel/parallel.h"
+
+#include <time.h>
+
+/* Default number of elements in the list */
+#define NUM 4000000
+
+/* Largest number of threads */
+#define MAX_THREADS 16
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+void sum_reduce(void* acc, const Data data) {
+    *((long*) acc) += *((int*) data);
+}
+
+void sum_combine(void* acc, const void* part) {
+    *((long*) acc) += *((const long*) part);
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    /* Key that is not in the list, so every search is a full scan */
+    int missing = -1;
+
+    List_t list = NULL;
+
+    int* x = NULL;
+
+    long sum = 0;
+
+    double start = 0;
+
+    double find = 0;
+
+    double reduce = 0;
+
+    /* ================================ */
+
+
+
+    list = List_create(free, NULL, int_match);
+
+    for (size_t i = 0; i < num; i++) {
+        x = (int*) malloc(sizeof(int));
+
+        *x = (int) i;
+
+        List_insert_last(list, x);
+    }
+
+    printf("elements: %lu, ms per full pass\n", num);
+
+    start = now();
+
+    List_find(list, &missing, NULL);
+
+    printf("%-8s %12.3f\n", "List_find", (now() - start) * 1e3);
+
+    printf("%-8s %12s %12s\n", "threads", "find", "reduce");
+
+    for (size_t threads = 1; threads <= MAX_THREADS; threads *= 2) {
+
+        start = now();
+
+        List_parallel_find(list, &missing, NULL, threads);
+
+        find = now() - start;
+
+        sum = 0;
+
+        start = now();
+
+        List_parallel_reduce(list, sum_reduce, sum_combine, &sum, sizeof(long), threads);
+
+        reduce = now() - start;
+
+        printf("%-8lu %12.3f %12.3f\n", threads, find * 1e3, reduce * 1e3);
+    }
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
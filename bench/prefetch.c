@@ -0,0 +1,115 @@
+#include "../src/list.h"
+
+#include <time.h>
+
+/* Default number of elements in the list */
+#define NUM 2000000
+
+/* Number of searches */
+#define RUNS 10
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+/* Called through a pointer like in List_find, so both loops do the same work apart from prefetching */
+match_fptr plain_match = int_match;
+
+/* ================================================================ */
+
+/**
+ * Time a full scan with List_find (prefetching) and with a plain loop, in ns per node.
+*/
+static void scan(const char* layout, const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Key that is not in the list, so every search is a full scan */
+    int missing = -1;
+
+    Node_t node = NULL;
+
+    double start = 0;
+
+    double prefetched = 0;
+
+    /* ================================ */
+
+
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        node = List_find(list, &missing, NULL);
+    }
+
+    prefetched = (now() - start) / RUNS / list->size * 1e9;
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        List_find_if(list, node, plain_match(node->data, &missing) == 0) ;
+    }
+
+    printf("%-10s %14.2f %14.2f\n", layout, prefetched, (now() - start) / RUNS / list->size * 1e9);
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    List_t list = NULL;
+
+    int* x = NULL;
+
+    /* ================================ */
+
+
+
+    srand(1);
+
+    list = List_create(free, NULL, int_match);
+
+    for (size_t i = 0; i < num; i++) {
+        x = (int*) malloc(sizeof(int));
+
+        *x = rand();
+
+        List_insert_last(list, x);
+    }
+
+    printf("elements: %lu, prefetch distance %d, ns per node\n", num, LIST_PREFETCH_DISTANCE);
+
+    printf("%-10s %14s %14s\n", "layout", "List_find", "plain loop");
+
+    /* Nodes follow each other in memory */
+    scan("sequential", list);
+
+    /* Sorting by random keys scatters consecutive nodes (and their data) all over the heap */
+    List_sort(list, NULL);
+
+    scan("random", list);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
@@ -0,0 +1,131 @@
+#include "../src/list.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+/* Default number of elements in the list */
+#define SIZE 1000
+
+/* Operations every thread performs */
+#define OPS 20000
+
+/* Largest number of threads */
+#define MAX_THREADS 32
+
+/* One operation out of this many changes the list, the rest are lookups */
+#define WRITE_EVERY 20
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+static int match_value(const Data a, const Data b) {
+    return (a == b) ? 0 : 1;
+}
+
+/* ================================================================ */
+
+static size_t size = SIZE;
+
+static List_t list = NULL;
+
+/* Lock of the plain list, taken around every call */
+static pthread_mutex_t list_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ================================================================ */
+
+/**
+ * Mostly lookups of values present in the list, with an occasional remove/insert pair that keeps its size.
+*/
+static void* worker(void* arg) {
+    int global = (arg != NULL);
+
+    uintptr_t seed = (uintptr_t) &seed;
+
+    for (size_t i = 0; i < OPS; i++) {
+
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+        if (global) {
+            pthread_mutex_lock(&list_lock);
+        }
+
+        if (i % WRITE_EVERY == 0) {
+            List_remove_first(list);
+
+            List_insert_last(list, (Data) (uintptr_t) ((seed >> 33) % size + 1));
+        }
+        else {
+            List_find(list, (Data) (uintptr_t) ((seed >> 33) % size + 1), match_value);
+        }
+
+        if (global) {
+            pthread_mutex_unlock(&list_lock);
+        }
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+/**
+ * Run the workload on a fresh list and return the number of operations per second.
+*/
+static double run(size_t threads, int global) {
+    pthread_t ids[MAX_THREADS];
+
+    double start = 0;
+
+    list = global ? List_create(NULL, NULL, NULL) : List_create_concurrent(NULL, NULL, NULL);
+
+    for (size_t i = 0; i < size; i++) {
+        List_insert_last(list, (Data) (uintptr_t) (i + 1));
+    }
+
+    start = now();
+
+    for (size_t i = 0; i < threads; i++) {
+        pthread_create(&ids[i], NULL, worker, global ? (void*) &list_lock : NULL);
+    }
+
+    for (size_t i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+
+    start = threads * OPS / (now() - start);
+
+    List_destroy(&list);
+
+    return start;
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+
+    size = (argc > 1) ? strtoul(argv[1], NULL, 10) : SIZE;
+
+    if (size == 0) {
+        size = SIZE;
+    }
+
+    printf("%-8s %18s %18s\n", "threads", "rwlock List ops/s", "mutex List ops/s");
+
+    for (size_t threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        printf("%-8lu %18.0f %18.0f\n", threads, run(threads, 0), run(threads, 1));
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
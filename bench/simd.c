@@ -0,0 +1,131 @@
+#include "../src/list.h"
+#include "../src/ulist/ulist.h"
+
+#include <time.h>
+
+/* Default number of elements in the lists */
+#define NUM 1000000
+
+/* Number of searches */
+#define RUNS 200
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+/* The match function of test/main.c */
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+/* ================================================================ */
+
+/**
+ * Time full scans of int lists: List_find with int_match, then unrolled lists with and without block keys.
+ * Built twice by the makefile: bench_simd.out picks vector instructions at run time,
+ * bench_simd_scalar.out is built with ULIST_NO_SIMD.
+*/
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    /* Payloads shared by all lists */
+    int* values = NULL;
+
+    /* Key that is not in the lists, so every search is a full scan */
+    int missing = -1;
+
+    List_t list = NULL;
+
+    UList_t ulist = NULL;
+
+    UList_t keyed = NULL;
+
+    double start = 0;
+
+    /* ================================ */
+
+
+
+    values = (int*) malloc(num * sizeof(int));
+
+    list = List_create(NULL, NULL, int_match);
+
+    ulist = UList_create(NULL, NULL, int_match);
+
+    keyed = UList_create_int(NULL, NULL, int_match);
+
+    for (size_t i = 0; i < num; i++) {
+        values[i] = (int) i;
+
+        List_insert_last(list, &values[i]);
+
+        UList_insert_last(ulist, &values[i]);
+
+        UList_insert_last(keyed, &values[i]);
+    }
+
+#ifdef ULIST_NO_SIMD
+    printf("build: ULIST_NO_SIMD, elements: %lu, ms per full scan\n", num);
+#else
+    printf("build: default, elements: %lu, ms per full scan\n", num);
+#endif
+
+    /* ================================ */
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        List_find(list, &missing, NULL);
+    }
+
+    printf("%-28s %8.3f\n", "List_find + int_match", (now() - start) / RUNS * 1e3);
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        UList_find(ulist, &missing, NULL);
+    }
+
+    printf("%-28s %8.3f\n", "UList_find + int_match", (now() - start) / RUNS * 1e3);
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        UList_find_int(ulist, missing);
+    }
+
+    printf("%-28s %8.3f\n", "UList_find_int (pointers)", (now() - start) / RUNS * 1e3);
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        UList_find_int(keyed, missing);
+    }
+
+    printf("%-28s %8.3f\n", "UList_find_int (block keys)", (now() - start) / RUNS * 1e3);
+
+    /* ================================ */
+
+    List_destroy(&list);
+
+    UList_destroy(&ulist);
+
+    UList_destroy(&keyed);
+
+    free(values);
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
@@ -0,0 +1,117 @@
+#include "../src/list.h"
+
+#include <time.h>
+
+/* Default number of elements in the list */
+#define NUM 20000
+
+/* Number of lookups */
+#define RUNS 2000
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_order(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) > *((int*) data_2)) - (*((int*) data_1) < *((int*) data_2));
+}
+
+/* ================================================================ */
+
+/**
+ * Time sorted insertion, positional access and lookups of random keys, in us per operation.
+*/
+static void run(const char* name, size_t num, int skip) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = NULL;
+
+    int* x = NULL;
+
+    int key = 0;
+
+    double start = 0;
+
+    double insert = 0;
+
+    double at = 0;
+
+    /* ================================ */
+
+
+
+    srand(1);
+
+    list = List_create(free, NULL, int_order);
+
+    if (skip) {
+        List_skip(list, NULL);
+    }
+
+    start = now();
+
+    for (size_t i = 0; i < num; i++) {
+        x = (int*) malloc(sizeof(int));
+
+        *x = rand();
+
+        List_insert_sorted(list, x, NULL);
+    }
+
+    insert = (now() - start) / num;
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        List_at(list, (size_t) rand() % num);
+    }
+
+    at = (now() - start) / RUNS;
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        key = *((int*) List_at(list, (size_t) rand() % num)->data);
+
+        List_find(list, &key, NULL);
+    }
+
+    printf("%-12s %12.3f %12.3f %12.3f\n", name, insert * 1e6, at * 1e6, ((now() - start) / RUNS - at) * 1e6);
+
+    List_destroy(&list);
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    /* ================================ */
+
+
+
+    printf("elements: %lu, us per operation\n", num);
+
+    printf("%-12s %12s %12s %12s\n", "list", "insert", "at", "find");
+
+    run("plain", num, 0);
+
+    run("skip", num, 1);
+
+    /* ================================ */
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
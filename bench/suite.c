@@ -0,0 +1,298 @@
+#include "../src/list.h"
+
+#include <time.h>
+
+/* Largest list size measured, sizes go 10, 100, ... up to it */
+#define MAX_SIZE 10000000
+
+/* Largest number of timed operations per measurement */
+#define SAMPLES 100000
+
+/* Seconds a single measurement may take, at least one operation is always timed */
+#define BUDGET 0.25
+
+/* ================================================================ */
+
+/* Memory layouts of the measured lists */
+enum layout {
+    /* Nodes allocated one by one with malloc, in list order */
+    SEQUENTIAL,
+
+    /* Nodes taken from a private pool */
+    POOLED,
+
+    /* Nodes allocated with malloc, then relinked into random memory order */
+    SHUFFLED
+};
+
+static const char* layouts[] = { "sequential", "pooled", "shuffled" };
+
+/* ================================================================ */
+
+/* Latencies of the timed operations, ns */
+static double samples[SAMPLES];
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2)) != 0;
+}
+
+int int_order(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) > *((int*) data_2)) - (*((int*) data_1) < *((int*) data_2));
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+static int compare_samples(const void* a, const void* b) {
+    return (*((const double*) a) > *((const double*) b)) - (*((const double*) a) < *((const double*) b));
+}
+
+/* ================================================================ */
+
+/**
+ * Build a list of `size` elements holding 0 .. size - 1 in the given layout.
+*/
+static List_t build(enum layout layout, size_t size) {
+    List_t list = (layout == POOLED) ? List_create_pooled(free, NULL, int_match, NULL) : List_create(free, NULL, int_match);
+
+    for (size_t i = 0; i < size; i++) {
+        List_insert_last(list, new_int((layout == SHUFFLED) ? rand() : (int) i));
+    }
+
+    /* Sorting by random values scatters consecutive nodes all over the heap, then values are renumbered */
+    if (layout == SHUFFLED) {
+        struct _list_cursor cursor;
+
+        List_sort(list, int_order);
+
+        List_cursor_init(&cursor, list);
+
+        for (int i = 0; cursor.node != NULL; List_cursor_next(&cursor), i++) {
+            *((int*) cursor.node->data) = i;
+        }
+    }
+
+    return list;
+}
+
+/* ================================================================ */
+
+/**
+ * Time operations on a list of the given size, storing latencies in `samples`.
+ *
+ * @return number of timed operations.
+*/
+static size_t measure(const char* op, enum layout layout, size_t size) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = NULL;
+
+    List_t other = NULL;
+
+    /* Nodes to be removed by List_remove_node, in random order */
+    Node_t* nodes = NULL;
+
+    struct _list_cursor cursor;
+
+    int* x = NULL;
+
+    int key = 0;
+
+    double deadline = now() + BUDGET;
+
+    double start = 0;
+
+    size_t count = 0;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ========== Operations that need a fresh list every time ======== */
+    /* ================================================================ */
+
+    if ((strcmp(op, "List_merge") == 0) || (strcmp(op, "List_destroy") == 0)) {
+
+        for (count = 0; (count == 0) || ((count < SAMPLES) && (now() < deadline)); count++) {
+
+            if (strcmp(op, "List_merge") == 0) {
+
+                /* Two halves merged into a list of `size` */
+                list = build(layout, size / 2);
+
+                other = build(layout, size - size / 2);
+
+                start = now();
+
+                List_merge(&list, &other);
+
+                samples[count] = (now() - start) * 1e9;
+            }
+            else {
+                list = build(layout, size);
+
+                start = now();
+
+                List_destroy(&list);
+
+                samples[count] = (now() - start) * 1e9;
+            }
+
+            List_destroy(&list);
+        }
+
+        return count;
+    }
+
+    /* ================================================================ */
+    /* ======== Operations timed one by one on a list of `size` ======= */
+    /* ================================================================ */
+
+    list = build(layout, size);
+
+    if (strcmp(op, "List_remove_node") == 0) {
+
+        nodes = (Node_t*) malloc(size * sizeof(Node_t));
+
+        List_cursor_init(&cursor, list);
+
+        for (size_t i = 0; i < size; i++, List_cursor_next(&cursor)) {
+            nodes[i] = cursor.node;
+        }
+
+        /* Fisher-Yates shuffle */
+        for (size_t i = size - 1; i > 0; i--) {
+            size_t j = (size_t) rand() % (i + 1);
+
+            Node_t node = nodes[i];
+
+            nodes[i] = nodes[j];
+
+            nodes[j] = node;
+        }
+    }
+
+    for (count = 0; (count == 0) || ((count < SAMPLES) && (now() < deadline)); count++) {
+
+        /* Removals stop when the list runs out */
+        if ((strncmp(op, "List_remove", 11) == 0) && (count == size)) {
+            break ;
+        }
+
+        x = new_int((int) (size + count));
+
+        key = rand() % (int) size;
+
+        start = now();
+
+        if (strcmp(op, "List_insert_first") == 0) {
+            List_insert_first(list, x);
+        }
+        else if (strcmp(op, "List_insert_last") == 0) {
+            List_insert_last(list, x);
+        }
+        else if (strcmp(op, "List_find") == 0) {
+            List_find(list, &key, NULL);
+        }
+        else if (strcmp(op, "List_remove_first") == 0) {
+            List_remove_first(list);
+        }
+        else if (strcmp(op, "List_remove_last") == 0) {
+            List_remove_last(list);
+        }
+        else if (strcmp(op, "List_remove_node") == 0) {
+            List_remove_node(list, nodes[count]);
+        }
+
+        samples[count] = (now() - start) * 1e9;
+
+        /* Data that was not inserted */
+        if (strncmp(op, "List_insert", 11) != 0) {
+            free(x);
+        }
+    }
+
+    free(nodes);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return count;
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    const char* ops[] = {
+        "List_insert_first", "List_insert_last", "List_find", "List_remove_first",
+        "List_remove_last", "List_remove_node", "List_merge", "List_destroy"
+    };
+
+    /* Largest list size */
+    size_t max_size = (argc > 1) ? strtoul(argv[1], NULL, 10) : MAX_SIZE;
+
+    size_t count = 0;
+
+    double total = 0;
+
+    /* ================================ */
+
+
+
+    srand(1);
+
+    /* One CSV row per operation, layout and size */
+    printf("op,layout,size,samples,mean_ns,p50_ns,p90_ns,p99_ns,max_ns,ops_per_s\n");
+
+    for (size_t size = 10; size <= max_size; size *= 10) {
+
+        for (size_t op = 0; op < sizeof(ops) / sizeof(ops[0]); op++) {
+
+            for (int layout = SEQUENTIAL; layout <= SHUFFLED; layout++) {
+
+                count = measure(ops[op], (enum layout) layout, size);
+
+                qsort(samples, count, sizeof(double), compare_samples);
+
+                total = 0;
+
+                for (size_t i = 0; i < count; i++) {
+                    total += samples[i];
+                }
+
+                printf("%s,%s,%lu,%lu,%.1f,%.1f,%.1f,%.1f,%.1f,%.0f\n", ops[op], layouts[layout], size, count,
+                       total / count, samples[count / 2], samples[count * 9 / 10], samples[count * 99 / 100], samples[count - 1],
+                       (total > 0) ? count / (total / 1e9) : 0);
+
+                fflush(stdout);
+            }
+        }
+    }
+
+    /* ================================ */
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
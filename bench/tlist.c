@@ -0,0 +1,122 @@
+#include "../src/list.h"
+#include "../src/tlist/tlist.h"
+
+#include <time.h>
+
+/* Default number of elements in the list */
+#define NUM 1000000
+
+/* Number of searches */
+#define RUNS 20
+
+/* ================================================================ */
+
+TLIST_DEFINE(IntList, int, TLIST_EQ, TLIST_NO_DESTROY)
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    /* Key that is not in the list, so every search is a full scan */
+    int missing = -1;
+
+    List_t list = NULL;
+
+    IntList_t ilist = NULL;
+
+    int* x = NULL;
+
+    double start = 0;
+
+    double insert = 0;
+
+    double find = 0;
+
+    /* ================================ */
+
+
+
+    printf("elements: %lu, ms\n", num);
+
+    printf("%-16s %10s %10s %10s\n", "list", "insert", "find", "destroy");
+
+    /* ============ Boxed ints compared through match_fptr ============ */
+    start = now();
+
+    list = List_create(free, NULL, int_match);
+
+    for (size_t i = 0; i < num; i++) {
+        x = (int*) malloc(sizeof(int));
+
+        *x = (int) i;
+
+        List_insert_last(list, x);
+    }
+
+    insert = now() - start;
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        List_find(list, &missing, NULL);
+    }
+
+    find = (now() - start) / RUNS;
+
+    start = now();
+
+    List_destroy(&list);
+
+    printf("%-16s %10.3f %10.3f %10.3f\n", "List_t", insert * 1e3, find * 1e3, (now() - start) * 1e3);
+
+    /* ============== Inline ints compared with == ==================== */
+    start = now();
+
+    ilist = IntList_create();
+
+    for (size_t i = 0; i < num; i++) {
+        IntList_insert_last(ilist, (int) i);
+    }
+
+    insert = now() - start;
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        IntList_find(ilist, missing);
+    }
+
+    find = (now() - start) / RUNS;
+
+    start = now();
+
+    IntList_destroy(&ilist);
+
+    printf("%-16s %10.3f %10.3f %10.3f\n", "TLIST(int)", insert * 1e3, find * 1e3, (now() - start) * 1e3);
+
+    /* ================================ */
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
@@ -0,0 +1,97 @@
+#include "../src/list.h"
+#include "../src/ulist/ulist.h"
+
+#include <time.h>
+
+/* Default number of elements in the lists */
+#define NUM 1000000
+
+/* Number of searches */
+#define RUNS 20
+
+/* ================================================================ */
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ================================================================ */
+
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+    /* =========== VARIABLES ========== */
+
+    /* Number of elements */
+    size_t num = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM;
+
+    /* Payloads shared by both lists */
+    int* values = NULL;
+
+    /* Key that is not in the lists, so every search is a full scan */
+    int missing = -1;
+
+    List_t list = NULL;
+
+    UList_t ulist = NULL;
+
+    double start = 0;
+
+    double list_time = 0;
+
+    double ulist_time = 0;
+
+    /* ================================ */
+
+
+
+    values = (int*) malloc(num * sizeof(int));
+
+    list = List_create(NULL, NULL, int_match);
+    ulist = UList_create(NULL, NULL, int_match);
+
+    /* Interleave insertions so list nodes are scattered across the heap like in a real program */
+    for (size_t i = 0; i < num; i++) {
+        values[i] = (int) i;
+
+        List_insert_last(list, &values[i]);
+        UList_insert_last(ulist, &values[i]);
+    }
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        List_find(list, &missing, NULL);
+    }
+
+    list_time = (now() - start) / RUNS;
+
+    start = now();
+
+    for (size_t i = 0; i < RUNS; i++) {
+        UList_find(ulist, &missing, NULL);
+    }
+
+    ulist_time = (now() - start) / RUNS;
+
+    printf("elements: %lu (%lu blocks of %d slots)\n", num, ulist->blocks, ULIST_SLOTS);
+    printf("List_find:  %8.3f ms per full scan\n", list_time * 1e3);
+    printf("UList_find: %8.3f ms per full scan\n", ulist_time * 1e3);
+
+    List_destroy(&list);
+    UList_destroy(&ulist);
+
+    free(values);
+
+    return EXIT_SUCCESS;
+}
+
+/* ================================================================ */
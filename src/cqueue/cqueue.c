@@ -0,0 +1,537 @@
+#include "cqueue.h"
+
+#include <pthread.h>
+
+/* Hazard pointers owned by a thread */
+#define CQUEUE_HAZARDS 2
+
+/* Retired nodes are reclaimed once a thread has this many of them */
+#define CQUEUE_RETIRE_THRESHOLD (2 * CQUEUE_HAZARDS * CQUEUE_MAX_THREADS)
+
+/* ================================================================ */
+/* ======================= HAZARD POINTERS ======================== */
+/* ================================================================ */
+
+/*
+ * A node removed from a queue may still be read by other threads that loaded it before the removal.
+ * Every thread announces the nodes it is about to read in its hazard pointers, and removed nodes are
+ * only freed when no hazard pointer refers to them. Records are shared by all queues.
+*/
+struct _hp_record {
+    /* Nodes the owner thread is reading */
+    _Atomic(struct _cqnode*) hazards[CQUEUE_HAZARDS];
+
+    /* Non-zero while a thread owns the record */
+    atomic_int active;
+
+    /* Removed nodes waiting to be freed */
+    struct _cqnode* retired[CQUEUE_RETIRE_THRESHOLD];
+
+    /* Number of retired nodes */
+    size_t count;
+};
+
+/* ================================ */
+
+static struct _hp_record hp_records[CQUEUE_MAX_THREADS];
+
+/* Record owned by the calling thread */
+static _Thread_local struct _hp_record* hp_record = NULL;
+
+/* Gives the record back when its thread exits */
+static pthread_key_t hp_key;
+
+static pthread_once_t hp_once = PTHREAD_ONCE_INIT;
+
+/* ================================================================ */
+/* ============================ STATIC ============================ */
+/* ================================================================ */
+
+/**
+ * Free retired nodes that are not protected by any hazard pointer.
+ *
+ * @param record record of the calling thread
+ *
+ * @return none.
+*/
+static void __HP_scan(struct _hp_record* record) {
+    /* =========== VARIABLES ========== */
+
+    /* Snapshot of all hazard pointers */
+    struct _cqnode* hazards[CQUEUE_MAX_THREADS * CQUEUE_HAZARDS];
+
+    size_t hazard_count = 0;
+
+    /* Number of nodes that must stay retired */
+    size_t kept = 0;
+
+    struct _cqnode* node = NULL;
+
+    size_t i = 0;
+
+    size_t j = 0;
+
+    /* ================================= */
+
+
+
+    for (i = 0; i < CQUEUE_MAX_THREADS; i++) {
+
+        for (j = 0; j < CQUEUE_HAZARDS; j++) {
+
+            if ((node = atomic_load(&hp_records[i].hazards[j])) != NULL) {
+                hazards[hazard_count++] = node;
+            }
+        }
+    }
+
+    /* ================================================================ */
+    /* ================ Free nodes nobody is reading ================== */
+    /* ================================================================ */
+
+    for (i = 0; i < record->count; i++) {
+
+        node = record->retired[i];
+
+        for (j = 0; (j < hazard_count) && (hazards[j] != node); j++) ;
+
+        if (j < hazard_count) {
+            record->retired[kept++] = node;
+        }
+        else {
+            free(node);
+        }
+    }
+
+    record->count = kept;
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+/**
+ * Give the record back when its thread exits. Nodes that are still protected stay in the record
+ * and are reclaimed by the next thread that takes it.
+ *
+ * @param record record of the exiting thread
+ *
+ * @return none.
+*/
+static void __HP_release(void* record) {
+
+    for (size_t j = 0; j < CQUEUE_HAZARDS; j++) {
+        atomic_store(&((struct _hp_record*) record)->hazards[j], NULL);
+    }
+
+    __HP_scan((struct _hp_record*) record);
+
+    atomic_store(&((struct _hp_record*) record)->active, 0);
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void __HP_init(void) {
+    pthread_key_create(&hp_key, __HP_release);
+}
+
+/* ================================================================ */
+
+/**
+ * Get the hazard pointer record of the calling thread, taking a free one on the first call.
+ *
+ * @return record of the calling thread on success, NULL if all records are taken.
+*/
+static struct _hp_record* __HP_record(void) {
+    /* =========== VARIABLES ========== */
+
+    int expected = 0;
+
+    /* ================================= */
+
+
+
+    if (hp_record != NULL) {
+        return hp_record;
+    }
+
+    pthread_once(&hp_once, __HP_init);
+
+    for (size_t i = 0; i < CQUEUE_MAX_THREADS; i++) {
+
+        expected = 0;
+
+        if (atomic_compare_exchange_strong(&hp_records[i].active, &expected, 1)) {
+
+            hp_record = &hp_records[i];
+
+            pthread_setspecific(hp_key, hp_record);
+
+            return hp_record;
+        }
+    }
+
+    LIST_WARN(__func__, "too many threads use concurrent queues, raise CQUEUE_MAX_THREADS");
+
+    /* ================================= */
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+/**
+ * Retire a node removed from a queue, reclaiming memory once enough nodes have been retired.
+ *
+ * @param record record of the calling thread
+ * @param node node to be retired
+ *
+ * @return none.
+*/
+static void __HP_retire(struct _hp_record* record, struct _cqnode* node) {
+
+    record->retired[record->count++] = node;
+
+    if (record->count == CQUEUE_RETIRE_THRESHOLD) {
+        __HP_scan(record);
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+/**
+ * Create a new node.
+ *
+ * @param data data to be inserted into a new node
+ *
+ * @return A new instance of a node on success, NULL on failure.
+*/
+static CQNode_t __CQNode_create(const Data data) {
+    /* =========== VARIABLES ========== */
+
+    CQNode_t node = NULL;
+
+    /* ================================= */
+
+
+
+    if ((node = (CQNode_t) malloc(sizeof(struct _cqnode))) != NULL) {
+
+        /* =============== Cast to avoid a warning message ================ */
+        node->data = (Data) data;
+
+        atomic_init(&node->next, NULL);
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return node;
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+CQueue_t CQueue_create(destroy_fptr destroy) {
+    /* =========== VARIABLES ========== */
+
+    /* Queue we are creating */
+    CQueue_t queue = NULL;
+
+    /* Dummy node the queue starts with */
+    CQNode_t dummy = NULL;
+
+    /* ================================= */
+
+
+
+    if ((dummy = __CQNode_create(NULL)) == NULL) {
+        return NULL;
+    }
+
+    /* ================================================================ */
+    /* ===== Dynamically allocate cache-aligned memory for a queue ==== */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((queue = (CQueue_t) aligned_alloc(CQUEUE_CACHE_LINE, sizeof(struct _concurrent_queue))) != NULL) {
+
+        /* Clear the memory/set some of the fields to its initial values */
+        memset(queue, 0, sizeof(struct _concurrent_queue));
+
+        /* ================================= */
+
+        atomic_init(&queue->head, dummy);
+
+        atomic_init(&queue->tail, dummy);
+
+        atomic_init(&queue->size, 0);
+
+        queue->destroy = destroy;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+
+        free(dummy);
+    }
+
+    /* ================================= */
+
+    return queue;
+}
+
+/* ================================================================ */
+
+int CQueue_enqueue(const CQueue_t queue, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    /* Hazard pointers of the calling thread */
+    struct _hp_record* record = NULL;
+
+    /* Node we want to add */
+    CQNode_t node = NULL;
+
+    /* Snapshot of the tail and the node after it */
+    CQNode_t tail = NULL;
+
+    CQNode_t next = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure a queue is not NULL ================= */
+    /* ================================================================ */
+
+    if (queue == NULL) {
+        LIST_WARN(__func__, "provided queue is NULL");
+
+        return -1;
+    }
+
+    if (((record = __HP_record()) == NULL) || ((node = __CQNode_create(data)) == NULL)) {
+        return -1;
+    }
+
+    /* ================================================================ */
+    /* ========== Link the node after the tail, then swing it ========= */
+    /* ================================================================ */
+
+    for (;;) {
+
+        tail = atomic_load(&queue->tail);
+
+        /* Protect the tail, then make sure it was not removed in between */
+        atomic_store(&record->hazards[0], tail);
+
+        if (tail != atomic_load(&queue->tail)) {
+            continue ;
+        }
+
+        next = atomic_load(&tail->next);
+
+        if (tail != atomic_load(&queue->tail)) {
+            continue ;
+        }
+
+        /* The tail is lagging behind, help the other producer */
+        if (next != NULL) {
+            atomic_compare_exchange_weak(&queue->tail, &tail, next);
+
+            continue ;
+        }
+
+        if (atomic_compare_exchange_weak(&tail->next, &next, node)) {
+            break ;
+        }
+    }
+
+    /* It is fine to fail here, somebody has already moved the tail */
+    atomic_compare_exchange_strong(&queue->tail, &tail, node);
+
+    atomic_store(&record->hazards[0], NULL);
+
+    atomic_fetch_add(&queue->size, 1);
+
+    /* ================================= */
+
+    return 0;
+}
+
+/* ================================================================ */
+
+int CQueue_dequeue(const CQueue_t queue, Data* data) {
+    /* =========== VARIABLES ========== */
+
+    /* Hazard pointers of the calling thread */
+    struct _hp_record* record = NULL;
+
+    /* Snapshot of the queue ends and the first element */
+    CQNode_t head = NULL;
+
+    CQNode_t tail = NULL;
+
+    CQNode_t next = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure a queue is not NULL ================= */
+    /* ================================================================ */
+
+    if ((queue == NULL) || (data == NULL)) {
+        LIST_WARN(__func__, "provided queue or data pointer is NULL");
+
+        return result;
+    }
+
+    if ((record = __HP_record()) == NULL) {
+        return result;
+    }
+
+    /* ================================================================ */
+    /* ============== Move the head one node forward ================== */
+    /* ================================================================ */
+
+    for (;;) {
+
+        head = atomic_load(&queue->head);
+
+        /* Protect the head, then make sure it was not removed in between */
+        atomic_store(&record->hazards[0], head);
+
+        if (head != atomic_load(&queue->head)) {
+            continue ;
+        }
+
+        tail = atomic_load(&queue->tail);
+
+        next = atomic_load(&head->next);
+
+        /* The first element must be protected too, its data is read below */
+        atomic_store(&record->hazards[1], next);
+
+        if (head != atomic_load(&queue->head)) {
+            continue ;
+        }
+
+        /* The queue is empty */
+        if (next == NULL) {
+            break ;
+        }
+
+        /* The tail is lagging behind, help the producer */
+        if (head == tail) {
+            atomic_compare_exchange_weak(&queue->tail, &tail, next);
+
+            continue ;
+        }
+
+        *data = next->data;
+
+        /* The first element becomes the new dummy node */
+        if (atomic_compare_exchange_weak(&queue->head, &head, next)) {
+
+            atomic_fetch_sub(&queue->size, 1);
+
+            result = 0;
+
+            break ;
+        }
+    }
+
+    atomic_store(&record->hazards[0], NULL);
+
+    atomic_store(&record->hazards[1], NULL);
+
+    /* The old dummy node is freed once no other thread reads it */
+    if (result == 0) {
+        __HP_retire(record, head);
+    }
+
+    /* ================================= */
+
+    return result;
+}
+
+/* ================================================================ */
+
+size_t CQueue_size(const CQueue_t queue) {
+    return (queue != NULL) ? atomic_load(&queue->size) : 0;
+}
+
+/* ================================================================ */
+
+int CQueue_destroy(CQueue_t* queue) {
+    /* =========== VARIABLES ========== */
+
+    /* Node that is being released */
+    CQNode_t node = NULL;
+
+    /* Node that follows the released one */
+    CQNode_t next = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure a queue is not NULL ================= */
+    /* ================================================================ */
+
+    if ((queue != NULL) && (*queue != NULL)) {
+
+        /* Nobody else uses the queue, so nodes are freed right away */
+        node = atomic_load(&(*queue)->head);
+
+        for (next = atomic_load(&node->next); next != NULL; node = next, next = atomic_load(&node->next)) {
+
+            /* Data lives in the node after the dummy one */
+            if ((*queue)->destroy != NULL) {
+                (*queue)->destroy(next->data);
+            }
+
+            free(node);
+        }
+
+        free(node);
+
+        /* Clear memory */
+        LIST_SCRUB(*queue, sizeof(struct _concurrent_queue));
+
+        /* Deallocate memory */
+        free(*queue);
+
+        *queue = NULL;
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
@@ -0,0 +1,132 @@
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include <stdatomic.h>
+
+#include "../data/data.h"
+#include "../diagnostics/diagnostics.h"
+#include "../../guard/guard.h"
+
+/* Maximum number of threads that use concurrent queues at the same time */
+#ifndef CQUEUE_MAX_THREADS
+    #define CQUEUE_MAX_THREADS 128
+#endif
+
+/* Queue ends are kept on separate cache lines */
+#define CQUEUE_CACHE_LINE 64
+
+/* ================================================================ */
+/* ======================= TYPES DEFINITIONS ====================== */
+/* ================================================================ */
+
+/**
+ * A structure that represents an individual node of a concurrent queue
+*/
+typedef struct _cqnode* CQNode_t;
+
+/* ================================ */
+
+/**
+ * A lock-free multi-producer multi-consumer FIFO queue (Michael-Scott)
+*/
+typedef struct _concurrent_queue* CQueue_t;
+
+/* ================================ */
+
+/* ================================================================ */
+/* ====================== TYPES IMPLEMENTAION ===================== */
+/* ================================================================ */
+
+struct _cqnode {
+    /* Pointer to a data container */
+    Data data;
+
+    /* The next node in the sequence */
+    _Atomic(struct _cqnode*) next;
+};
+
+struct _concurrent_queue {
+    /* Dummy node, the first element is the one after it. Consumers work here */
+    _Alignas(CQUEUE_CACHE_LINE) _Atomic(struct _cqnode*) head;
+
+    /* Last node of the queue. Producers work here */
+    _Alignas(CQUEUE_CACHE_LINE) _Atomic(struct _cqnode*) tail;
+
+    /* Number of elements in the queue (exact only when the queue is not in use) */
+    _Alignas(CQUEUE_CACHE_LINE) atomic_size_t size;
+
+    /* The encapsulated destroy function passed to CQueue_create */
+    destroy_fptr destroy;
+};
+
+/* ================================================================ */
+/* ========================= CQueue_t API ========================= */
+/* ================================================================ */
+
+/**
+ * Allocate a new instance of a concurrent queue.
+ *
+ * @param destroy pointer to a function that handles the deletion of data left in the queue
+ *
+ * @return a new instance of a concurrent queue on success, NULL on failure.
+*/
+extern CQueue_t CQueue_create(destroy_fptr destroy);
+
+/* ================================================================ */
+
+/**
+ * Append data at the end of the queue. Safe to call from any number of threads.
+ *
+ * @param queue queue to insert into
+ * @param data data to be inserted
+ *
+ * @return 0 on success, negative value on error.
+*/
+extern int CQueue_enqueue(const CQueue_t queue, const Data data);
+
+/* ================================================================ */
+
+/**
+ * Take data from the beginning of the queue. Safe to call from any number of threads.
+ * The data is handed over to the caller and is not destroyed.
+ *
+ * @param queue queue to remove from
+ * @param data where to store the removed data
+ *
+ * @return 0 on success, negative value if the queue is empty or on error.
+*/
+extern int CQueue_dequeue(const CQueue_t queue, Data* data);
+
+/* ================================================================ */
+
+/**
+ * Get the number of elements in the queue. The value may be stale while other threads use the queue.
+ *
+ * @param queue queue to be measured
+ *
+ * @return number of elements.
+*/
+extern size_t CQueue_size(const CQueue_t queue);
+
+/* ================================================================ */
+
+/**
+ * Destroy the queue and the data left in it. No other thread may use the queue any more.
+ *
+ * @param queue queue to be destroyed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int CQueue_destroy(CQueue_t* queue);
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
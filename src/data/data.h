@@ -1,6 +1,8 @@
 #ifndef DATA_H
 #define DATA_H
 
+#include <stddef.h>
+
 /* ================================================================ */
 /* ======================= TYPES DEFINITIONS ====================== */
 /* ================================================================ */
@@ -31,6 +33,34 @@ typedef void (*destroy_fptr)(Data data);
 */
 typedef int (*match_fptr)(const Data data_1, const Data data_2);
 
+/* ================================ */
+
+/**
+ * A pointer to a user defined function that computes a hash of data. Data that matches must hash equally
+*/
+typedef size_t (*hash_fptr)(const Data data);
+
+/* ================================ */
+
+/**
+ * A pointer to a user defined function that is called on data, `arg` is passed through unchanged
+*/
+typedef void (*visit_fptr)(Data data, void* arg);
+
+/* ================================ */
+
+/**
+ * A pointer to a user defined function that folds data into an accumulator
+*/
+typedef void (*reduce_fptr)(void* acc, const Data data);
+
+/* ================================ */
+
+/**
+ * A pointer to a user defined function that folds a partial accumulator into another one
+*/
+typedef void (*combine_fptr)(void* acc, const void* part);
+
 /* ================================================================ */
 
 #endif
\ No newline at end of file
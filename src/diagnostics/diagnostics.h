@@ -0,0 +1,44 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include <string.h>
+
+#include "../../guard/guard.h"
+
+/*
+ * Failure messages of every list module go through these macros. LIST_NO_DIAGNOSTICS builds drop the calls
+ * together with their message strings, so failures are reported by return values only.
+ * Memory released by the modules is zeroed through LIST_SCRUB, which LIST_NO_SCRUB builds drop.
+*/
+
+/* ================================================================ */
+
+/* Report a failure through guard */
+#ifdef LIST_NO_DIAGNOSTICS
+    #define LIST_WARN(func_name, msg) ((void) (func_name))
+
+    #define LIST_WARN_SYS(func_name) ((void) (func_name))
+#else
+    #define LIST_WARN(func_name, msg) warn_with_user_msg((func_name), (msg))
+
+    #define LIST_WARN_SYS(func_name) warn_with_sys_msg((func_name))
+#endif
+
+/* Zero nodes and lists before they are released, unless the build asks not to */
+#ifdef LIST_NO_SCRUB
+    #define LIST_SCRUB(ptr, size) ((void) 0)
+#else
+    #define LIST_SCRUB(ptr, size) memset((ptr), 0, (size))
+#endif
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
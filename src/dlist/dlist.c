@@ -0,0 +1,852 @@
+#include "dlist.h"
+
+/* ================================================================ */
+/* ============================ STATIC ============================ */
+/* ================================================================ */
+
+/**
+ * Create a new node for the list, taking it from the list pool if there is one.
+ *
+ * @param list list the node is created for
+ * @param data data to be inserted into a new node
+ *
+ * @return A new instance of a node on success, NULL on failure.
+*/
+static DNode_t __DNode_alloc(const DList_t list, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    DNode_t node = NULL;
+
+    /* ================================= */
+
+
+
+    if (list->pool == NULL) {
+        return DNode_create(data);
+    }
+
+    /* ================================================================ */
+    /* ================ Take a node from the list pool ================ */
+    /* ================================================================ */
+
+    if ((node = (DNode_t) Pool_alloc(list->pool)) != NULL) {
+
+        /* =============== Cast to avoid a warning message ================ */
+        node->data = (Data) data;
+
+        node->prev = node->next = NULL;
+    }
+
+    /* Pool_alloc function will tell you if there is an error occured while node allocation */
+
+    /* ================================= */
+
+    return node;
+}
+
+/* ================================================================ */
+
+/**
+ * Link a node into the list right after the given node.
+ *
+ * @param list list to link into
+ * @param prev node that precedes the new node, NULL to make the new node the head
+ * @param node node to be linked
+ *
+ * @return none.
+*/
+static void __DList_link(const DList_t list, const DNode_t prev, const DNode_t node) {
+
+    node->prev = prev;
+
+    node->next = (prev != NULL) ? prev->next : list->head;
+
+    /* Connect the new node with its neighbours */
+    if (node->next != NULL) {
+        node->next->prev = node;
+    }
+    else {
+        list->tail = node;
+    }
+
+    if (prev != NULL) {
+        prev->next = node;
+    }
+    else {
+        list->head = node;
+    }
+
+    list->size++;
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+#ifdef LIST_DEBUG
+/**
+ * Check that the node is one of the nodes of the list.
+ *
+ * @param list list to search in
+ * @param node node to be searched
+ *
+ * @return non-zero if the node belongs to the list, zero otherwise.
+*/
+static int __DList_owns(const DList_t list, const DNode_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are using to traverse the list */
+    DNode_t temp = NULL;
+
+    /* ================================= */
+
+
+
+    for (temp = list->head; (temp != NULL) && (temp != node); temp = temp->next) ;
+
+    /* ================================= */
+
+    return temp != NULL;
+}
+#endif
+
+/* ================================================================ */
+
+/**
+ * Unlink the node from the list and destroy it.
+ *
+ * @param list list the node belongs to
+ * @param node node to be removed
+ *
+ * @return a pointer to data to be deleted.
+*/
+static Data __DList_unlink(const DList_t list, DNode_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* Data to be destroyed */
+    Data data = node->data;
+
+    /* ================================= */
+
+
+
+    /* Bypass the node in both directions */
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    }
+    else {
+        list->head = node->next;
+    }
+
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    }
+    else {
+        list->tail = node->prev;
+    }
+
+    list->size--;
+
+    /* Clear memory */
+    LIST_SCRUB(node, sizeof(struct _dnode));
+
+    /* Deallocate memory or give the node back to the pool */
+    if (list->pool != NULL) {
+        Pool_free(list->pool, node);
+    }
+    else {
+        free(node);
+    }
+
+    /* ================================= */
+
+    return data;
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+DNode_t DNode_create(const Data data) {
+    /* =========== VARIABLES ========== */
+
+    DNode_t node = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ==== Dynamically allocate memory for a doubly linked node ====== */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((node = (DNode_t) malloc(sizeof(struct _dnode))) != NULL) {
+
+        /* =============== Cast to avoid a warning message ================ */
+        node->data = (Data) data;
+
+        node->prev = node->next = NULL;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return node;
+}
+
+/* ================================================================ */
+
+DList_t DList_create(destroy_fptr destroy, print_fptr print, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    DList_t list = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ==== Dynamically allocate memory for a doubly linked list ====== */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((list = (DList_t) malloc(sizeof(struct _doubly_linked_list))) != NULL) {
+
+        /* Clear the memory/set some of the fields to its initial values */
+        memset(list, 0, sizeof(struct _doubly_linked_list));
+
+        /* ================================= */
+
+        list->destroy = destroy;
+
+        list->print = print;
+
+        list->match = match;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+DList_t DList_create_pooled(destroy_fptr destroy, print_fptr print, match_fptr match, const Pool_t pool) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    DList_t list = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================= Make sure pool items fit a node ============== */
+    if ((pool != NULL) && (pool->item_size < sizeof(struct _dnode))) {
+        LIST_WARN(__func__, "pool items are too small to hold a list node");
+
+        return NULL;
+    }
+
+    /* ================================= */
+
+    if ((list = DList_create(destroy, print, match)) != NULL) {
+
+        /* Share the given pool or create a private one */
+        list->pool = (pool != NULL) ? Pool_retain(pool) : Pool_create(sizeof(struct _dnode), 0);
+
+        if (list->pool == NULL) {
+            DList_destroy(&list);
+        }
+    }
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+void DList_print(const DList_t list, print_fptr print) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative print function */
+    print_fptr alt_print = NULL;
+
+    /* Node we are using to traverse the list */
+    DNode_t node = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ============= Make sure there is a function to use ============= */
+        if ((list->print == NULL) && (print == NULL)) {
+            LIST_WARN(__func__, "there is no associated `print` function with the given list");
+
+            return ;
+        }
+
+        /* ================================= */
+
+        printf("[");
+
+        /* Use alternative print function if provided */
+        alt_print = (print != NULL) ? print : list->print;
+
+        for (node = list->head; node != NULL; node = node->next) {
+
+            /* Print the node data */
+            alt_print(node->data);
+
+            if (node->next != NULL) {
+                printf(", ");
+            }
+        }
+
+        printf("]\n");
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int DList_insert_first(const DList_t list, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we want to add */
+    DNode_t node = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ====================== Create a new node  ====================== */
+        if ((node = __DNode_alloc(list, data)) != NULL) {
+
+            __DList_link(list, NULL, node);
+
+            /* ================================= */
+
+            result = 0;
+        }
+
+        /* __DNode_alloc function will tell you if there is an error occured while node creation */
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int DList_insert_last(const DList_t list, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we want to add */
+    DNode_t node = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ====================== Create a new node  ====================== */
+        if ((node = __DNode_alloc(list, data)) != NULL) {
+
+            __DList_link(list, list->tail, node);
+
+            /* ================================= */
+
+            result = 0;
+        }
+
+        /* __DNode_alloc function will tell you if there is an error occured while node creation */
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+DNode_t DList_find(const DList_t list, const Data data, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative match function */
+    match_fptr alt_match = NULL;
+
+    /* Node we are using to traverse the list */
+    DNode_t node = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if (data != NULL) {
+
+            /* ============= Make sure there is a function to use ============= */
+            if ((list->match == NULL) && (match == NULL)) {
+                LIST_WARN(__func__, "there is no associated `match` function with the given list");
+
+                return NULL;
+            }
+
+            /* ================================= */
+
+            /* Use alternative match function if provided */
+            alt_match = (match != NULL) ? match : list->match;
+
+            /* Traverse the list and compare its data */
+            for (node = list->head; (node != NULL) && (alt_match(node->data, data) != 0); node = node->next) ;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return node;
+}
+
+/* ================================================================ */
+
+int DList_remove_first(const DList_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Data to be deleted */
+    Data data = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            data = __DList_unlink(list, list->head);
+
+            /* Destroy data if needed */
+            if (list->destroy != NULL) {
+                list->destroy(data);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int DList_remove_last(const DList_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Data to be deleted */
+    Data data = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            /* No traversal, the tail knows its predecessor */
+            data = __DList_unlink(list, list->tail);
+
+            /* Destroy data if needed */
+            if (list->destroy != NULL) {
+                list->destroy(data);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int DList_destroy(DList_t* list) {
+    /* =========== VARIABLES ========== */
+
+    /* Data to be deleted */
+    Data data = NULL;
+
+    /* Node we are using to traverse the list */
+    DNode_t node = NULL;
+
+    /* Operation result */
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if ((list != NULL) && (*list != NULL)) {
+
+        /* The list is the only owner of its pool, so nodes are released along with it */
+        if (((*list)->pool != NULL) && ((*list)->pool->refs == 1)) {
+
+            if ((*list)->destroy != NULL) {
+                for (node = (*list)->head; node != NULL; node = node->next) {
+                    (*list)->destroy(node->data);
+                }
+            }
+        }
+        /* Repeatedly delete elements */
+        else {
+            while ((*list)->size > 0) {
+                data = __DList_unlink(*list, (*list)->head);
+
+                if ((*list)->destroy != NULL) {
+                    (*list)->destroy(data);
+                }
+            }
+        }
+
+        /* Release the pool (or the reference to a shared one) */
+        Pool_destroy(&(*list)->pool);
+
+        /* Clear memory */
+        LIST_SCRUB(*list, sizeof(struct _doubly_linked_list));
+
+        /* Deallocate memory */
+        free(*list);
+
+        *list = NULL;
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int DList_merge(const DList_t* dest, DList_t* src) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ============ Make sure both dest and src are not NULL ========== */
+    /* ================================================================ */
+
+    if ((dest != NULL) && (*dest != NULL) && (src != NULL) && (*src != NULL)) {
+
+        if (*dest == *src) {
+            LIST_WARN(__func__, "a list cannot be merged into itself");
+
+            return result;
+        }
+
+        /* Nodes can be relinked only if both lists take them from the same place */
+        if ((*dest)->pool == (*src)->pool) {
+
+            if ((*src)->size > 0) {
+
+                /* Connect the dest tail and the src head */
+                (*src)->head->prev = (*dest)->tail;
+
+                if ((*dest)->size == 0) {
+                    (*dest)->head = (*src)->head;
+                }
+                else {
+                    (*dest)->tail->next = (*src)->head;
+                }
+
+                (*dest)->tail = (*src)->tail;
+
+                (*dest)->size += (*src)->size;
+            }
+        }
+        /* Otherwise data is moved into nodes owned by the dest list */
+        else {
+
+            while ((*src)->size > 0) {
+
+                if (DList_insert_last(*dest, (*src)->head->data) != 0) {
+                    return result;
+                }
+
+                /* Data now belongs to dest, so it is not destroyed */
+                __DList_unlink(*src, (*src)->head);
+            }
+        }
+
+        /* ================================ */
+
+        /* After the merge, the `src` list is eliminated */
+        (*src)->head = (*src)->tail = NULL;
+
+        (*src)->size = 0;
+
+        DList_destroy(src);
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int DList_remove_node(const DList_t list, DNode_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* Data to be deleted */
+    Data data = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a node is not NULL ================= */
+    /* ================================================================ */
+
+    if (node == NULL) {
+        return result;
+    }
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+#ifdef LIST_DEBUG
+        /* Make sure the specified node is in the list */
+        if (!__DList_owns(list, node)) {
+            LIST_WARN(__func__, "provided node is not in the list");
+
+            return result;
+        }
+#endif
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            data = __DList_unlink(list, node);
+
+            /* Destroy data if needed */
+            if (list->destroy != NULL) {
+                list->destroy(data);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int DList_insert_after(const DList_t list, const Data data, const DNode_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are creating */
+    DNode_t new_node = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================== Make sure list is not NULL ================== */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+#ifdef LIST_DEBUG
+        /* Make sure the specified node is in the list */
+        if ((node != NULL) && !__DList_owns(list, node)) {
+            LIST_WARN(__func__, "provided node is not in the list");
+
+            return result;
+        }
+#endif
+
+        /* ====================== Create a new node  ====================== */
+        if ((new_node = __DNode_alloc(list, data)) != NULL) {
+
+            /* Special case. When there is no any node in the list, or no node given */
+            __DList_link(list, ((list->size == 0) || (node == NULL)) ? list->tail : node, new_node);
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int DList_insert_before(const DList_t list, const Data data, const DNode_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are creating */
+    DNode_t new_node = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================== Make sure list is not NULL ================== */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+#ifdef LIST_DEBUG
+        /* Make sure the specified node is in the list */
+        if ((node != NULL) && !__DList_owns(list, node)) {
+            LIST_WARN(__func__, "provided node is not in the list");
+
+            return result;
+        }
+#endif
+
+        /* ====================== Create a new node  ====================== */
+        if ((new_node = __DNode_alloc(list, data)) != NULL) {
+
+            /* Special case. When there is no any node in the list, or no node given */
+            __DList_link(list, ((list->size == 0) || (node == NULL)) ? NULL : node->prev, new_node);
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
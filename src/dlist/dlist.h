@@ -0,0 +1,253 @@
+#ifndef DOUBLY_LINKED_LIST_H
+#define DOUBLY_LINKED_LIST_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../data/data.h"
+#include "../pool/pool.h"
+#include "../diagnostics/diagnostics.h"
+#include "../../guard/guard.h"
+
+/*
+ * Doubly linked list with an API of its own, List_t lists stay singly linked. Nodes link back to their
+ * predecessor, so removal of the last node and of a given node, and insertion before a node, take constant time.
+*/
+
+#define DList_size(list) ((list != NULL) ? list->size : -1)
+
+/* ================================================================ */
+/* ======================= TYPES DEFINITIONS ====================== */
+/* ================================================================ */
+
+/**
+ * A structure that represents an individual node of a doubly linked list
+*/
+typedef struct _dnode* DNode_t;
+
+/* ================================ */
+
+/**
+ * A data type that represents a set of nodes linked in both directions
+*/
+typedef struct _doubly_linked_list* DList_t;
+
+/* ================================ */
+
+/* ================================================================ */
+/* ====================== TYPES IMPLEMENTAION ===================== */
+/* ================================================================ */
+
+struct _dnode {
+    /* Pointer to a data container */
+    Data data;
+
+    /* The previous node in the sequence */
+    struct _dnode* prev;
+
+    /* The next node in the sequence */
+    struct _dnode* next;
+};
+
+struct _doubly_linked_list {
+    /* Number of elements in the list */
+    size_t size;
+
+    /* First element of the list */
+    struct _dnode* head;
+
+    /* Last element of the list */
+    struct _dnode* tail;
+
+    /* Pool the nodes are taken from, NULL if nodes are allocated one by one */
+    Pool_t pool;
+
+    /* The encapsulated destroy function passed to DList_create */
+    destroy_fptr destroy;
+
+    /* The encapsulated print function passed to DList_create */
+    print_fptr print;
+
+    /* The encapsulated match function passed to DList_create */
+    match_fptr match;
+};
+
+/* ================================================================ */
+/* ========================== DList_t API ========================= */
+/* ================================================================ */
+
+/**
+ * Create a new doubly linked node.
+ *
+ * @param data data to be inserted into a new node
+ *
+ * @return A new instance of a node on success, NULL on failure.
+*/
+extern DNode_t DNode_create(const Data data);
+
+/**
+ * Allocate a new instance of a doubly linked list data type.
+ *
+ * @param destroy pointer to a function that handles the deletion of a list node
+ * @param print pointer to a function that prints data residing in a list node
+ * @param match a pointer to a function that compares data in a list node
+ *
+ * @return a new instance of a doubly linked list on success, NULL on failure.
+*/
+extern DList_t DList_create(destroy_fptr destroy, print_fptr print, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Allocate a new instance of a doubly linked list data type whose nodes are taken from a pool.
+ *
+ * @param destroy pointer to a function that handles the deletion of a list node
+ * @param print pointer to a function that prints data residing in a list node
+ * @param match a pointer to a function that compares data in a list node
+ * @param pool pool to share with other lists (items of at least sizeof(struct _dnode) bytes), or NULL to create a private one
+ *
+ * @return a new instance of a doubly linked list on success, NULL on failure.
+*/
+extern DList_t DList_create_pooled(destroy_fptr destroy, print_fptr print, match_fptr match, const Pool_t pool);
+
+/* ================================================================ */
+
+/**
+ * Output the content of a doubly linked list.
+ *
+ * @param list list to be printed out
+ * @param print alternative print function used to handle data in a list node
+ *
+ * @return none.
+*/
+extern void DList_print(const DList_t list, print_fptr print);
+
+/* ================================================================ */
+
+/**
+ * Insert a new element with specified data at the beginning of the list
+ *
+ * @param list list to insert into
+ * @param data data to be inserted
+ *
+ * @return 0 on success, negative value on error.
+*/
+extern int DList_insert_first(const DList_t list, const Data data);
+
+/* ================================================================ */
+
+/**
+ * Insert a new element with specified data at the end of the list
+ *
+ * @param list list to insert into
+ * @param data data to be inserted
+ *
+ * @return 0 on success, negative value on error.
+*/
+extern int DList_insert_last(const DList_t list, const Data data);
+
+/* ================================================================ */
+
+/**
+ * Find a node in the list with specified data (the first occurrence).
+ *
+ * @param list list to search in
+ * @param data data to be searched
+ * @param match alternative match function used to compare data in a list node
+ *
+ * @return node with the specified data on success, NULL on failure.
+*/
+extern DNode_t DList_find(const DList_t list, const Data data, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Remove the first element from the list
+ *
+ * @param list list to remove from
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int DList_remove_first(const DList_t list);
+
+/* ================================================================ */
+
+/**
+ * Remove the last element from the list in constant time
+ *
+ * @param list list to remove from
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int DList_remove_last(const DList_t list);
+
+/* ================================================================ */
+
+/**
+ * Destroy the doubly linked list.
+ *
+ * @param list list to be destroyed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int DList_destroy(DList_t* list);
+
+/* ================================================================ */
+
+/**
+ * Merge two lists into one.
+ *
+ * @param dest the destination list
+ * @param src the source list, the one to be merged into dest list
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int DList_merge(const DList_t* dest, DList_t* src);
+
+/* ================================================================ */
+
+/**
+ * Remove the specified node from the list in constant time. The node must belong to the list: a node of
+ * another list is unlinked from that list and corrupts both of them. LIST_DEBUG builds check membership in O(n).
+ *
+ * @param list list to remove from
+ * @param node node to be removed
+ *
+ * @return 0 on success, negative value on failure.
+ */
+extern int DList_remove_node(const DList_t list, DNode_t node);
+
+/* ================================================================ */
+
+/**
+ * Insert a new node with specified data after the node. The node must belong to the list (checked in LIST_DEBUG builds).
+ *
+ * @param list list to insert into
+ * @param data data to be inserted
+ * @param node node that precedes the new node
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int DList_insert_after(const DList_t list, const Data data, const DNode_t node);
+
+/* ================================================================ */
+
+/**
+ * Insert a new node with specified data before the node in constant time. The node must belong to the list (checked in LIST_DEBUG builds).
+ *
+ * @param list list to insert into
+ * @param data data to be inserted
+ * @param node node that follows the new node
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int DList_insert_before(const DList_t list, const Data data, const DNode_t node);
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
@@ -0,0 +1,513 @@
+#include "ilist.h"
+
+/* Get the link embedded into the element */
+#define ILIST_LINK(list, element) ((ILink_t) ((char*) (element) + (list)->offset))
+
+/* Get the element that embeds the link */
+#define ILIST_ELEMENT(list, link) ((Data) ((char*) (link) - (list)->offset))
+
+/* ================================================================ */
+/* ============================ STATIC ============================ */
+/* ================================================================ */
+
+/**
+ * Unlink the element that follows the given link.
+ *
+ * @param list list to remove from
+ * @param prev link that precedes the element, NULL if the element is the head
+ *
+ * @return the unlinked element.
+*/
+static Data __IList_unlink(const IList_t list, const ILink_t prev) {
+    /* =========== VARIABLES ========== */
+
+    /* Link of the element being removed */
+    ILink_t link = (prev != NULL) ? prev->next : list->head;
+
+    /* ================================= */
+
+
+
+    if (prev != NULL) {
+        prev->next = link->next;
+    }
+    else {
+        list->head = link->next;
+    }
+
+    if (link == list->tail) {
+        list->tail = prev;
+    }
+
+    /* The link can be reused right away */
+    link->next = NULL;
+
+    list->size--;
+
+    /* ================================= */
+
+    return ILIST_ELEMENT(list, link);
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+IList_t IList_create(size_t offset, destroy_fptr destroy, print_fptr print, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    IList_t list = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ====== Dynamically allocate memory for an intrusive list ======= */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((list = (IList_t) malloc(sizeof(struct _intrusive_list))) != NULL) {
+
+        /* Clear the memory/set some of the fields to its initial values */
+        memset(list, 0, sizeof(struct _intrusive_list));
+
+        /* ================================= */
+
+        list->offset = offset;
+
+        list->destroy = destroy;
+
+        list->print = print;
+
+        list->match = match;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+void IList_print(const IList_t list, print_fptr print) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative print function */
+    print_fptr alt_print = NULL;
+
+    /* Link we are using to traverse the list */
+    ILink_t link = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ============= Make sure there is a function to use ============= */
+        if ((list->print == NULL) && (print == NULL)) {
+            LIST_WARN(__func__, "there is no associated `print` function with the given list");
+
+            return ;
+        }
+
+        /* ================================= */
+
+        printf("[");
+
+        /* Use alternative print function if provided */
+        alt_print = (print != NULL) ? print : list->print;
+
+        for (link = list->head; link != NULL; link = link->next) {
+
+            /* Print the element */
+            alt_print(ILIST_ELEMENT(list, link));
+
+            if (link->next != NULL) {
+                printf(", ");
+            }
+        }
+
+        printf("]\n");
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int IList_insert_first(const IList_t list, const Data element) {
+    /* =========== VARIABLES ========== */
+
+    /* Link embedded into the element */
+    ILink_t link = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if (element != NULL) {
+
+            link = ILIST_LINK(list, element);
+
+            /* Connect the element with the list head */
+            link->next = list->head;
+
+            if (list->size == 0) {
+                list->tail = link;
+            }
+
+            list->head = link;
+
+            list->size++;
+
+            /* ================================= */
+
+            result = 0;
+        }
+        else {
+            LIST_WARN(__func__, "provided element is NULL");
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int IList_insert_last(const IList_t list, const Data element) {
+    /* =========== VARIABLES ========== */
+
+    /* Link embedded into the element */
+    ILink_t link = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if (element != NULL) {
+
+            link = ILIST_LINK(list, element);
+
+            link->next = NULL;
+
+            /* Connect the element with the list tail */
+            if (list->size == 0) {
+                list->head = link;
+            }
+            else {
+                list->tail->next = link;
+            }
+
+            list->tail = link;
+
+            list->size++;
+
+            /* ================================= */
+
+            result = 0;
+        }
+        else {
+            LIST_WARN(__func__, "provided element is NULL");
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+Data IList_find(const IList_t list, const Data data, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative match function */
+    match_fptr alt_match = NULL;
+
+    /* Link we are using to traverse the list */
+    ILink_t link = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if (data != NULL) {
+
+            /* ============= Make sure there is a function to use ============= */
+            if ((list->match == NULL) && (match == NULL)) {
+                LIST_WARN(__func__, "there is no associated `match` function with the given list");
+
+                return NULL;
+            }
+
+            /* ================================= */
+
+            /* Use alternative match function if provided */
+            alt_match = (match != NULL) ? match : list->match;
+
+            /* Elements are compared in place, the link and the payload share a cache line */
+            for (link = list->head; link != NULL; link = link->next) {
+
+                if (alt_match(ILIST_ELEMENT(list, link), data) == 0) {
+                    return ILIST_ELEMENT(list, link);
+                }
+            }
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int IList_remove_first(const IList_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Element to be deleted */
+    Data element = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            element = __IList_unlink(list, NULL);
+
+            /* Destroy the element if needed */
+            if (list->destroy != NULL) {
+                list->destroy(element);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int IList_remove_last(const IList_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Link that is used to traverse the list */
+    ILink_t prev = NULL;
+
+    /* Element to be deleted */
+    Data element = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            /* Find the link that precedes the tail */
+            if (list->size > 1) {
+                for (prev = list->head; prev->next != list->tail; prev = prev->next) ;
+            }
+
+            element = __IList_unlink(list, prev);
+
+            /* Destroy the element if needed */
+            if (list->destroy != NULL) {
+                list->destroy(element);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int IList_remove(const IList_t list, const Data element) {
+    /* =========== VARIABLES ========== */
+
+    /* Link embedded into the element */
+    ILink_t link = NULL;
+
+    /* Link that is used to traverse the list */
+    ILink_t prev = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if ((element != NULL) && (list->size > 0)) {
+
+            link = ILIST_LINK(list, element);
+
+            /* Make sure the element is in the list */
+            if (link != list->head) {
+                for (prev = list->head; (prev != NULL) && (prev->next != link); prev = prev->next) ;
+            }
+
+            /* The element IS in the list */
+            if ((link == list->head) || (prev != NULL)) {
+
+                __IList_unlink(list, prev);
+
+                /* Destroy the element if needed */
+                if (list->destroy != NULL) {
+                    list->destroy(element);
+                }
+
+                /* ================================ */
+
+                result = 0;
+            }
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int IList_destroy(IList_t* list) {
+    /* =========== VARIABLES ========== */
+
+    /* Element to be deleted */
+    Data element = NULL;
+
+    /* Operation result */
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if ((list != NULL) && (*list != NULL)) {
+
+        /* Unlink elements and hand them over to the destroy function */
+        while ((*list)->size > 0) {
+
+            element = __IList_unlink(*list, NULL);
+
+            if ((*list)->destroy != NULL) {
+                (*list)->destroy(element);
+            }
+        }
+
+        /* Clear memory */
+        LIST_SCRUB(*list, sizeof(struct _intrusive_list));
+
+        /* Deallocate memory */
+        free(*list);
+
+        *list = NULL;
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
@@ -0,0 +1,192 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "../data/data.h"
+#include "../diagnostics/diagnostics.h"
+#include "../../guard/guard.h"
+
+#define IList_size(list) ((list != NULL) ? list->size : -1)
+
+/**
+ * Get the element that embeds the link.
+ *
+ * @param link pointer to the struct _ilink member of the element
+ * @param type type of the element
+ * @param member name of the struct _ilink member in the element type
+*/
+#define IList_entry(link, type, member) ((type*) ((char*) (link) - offsetof(type, member)))
+
+/* ================================================================ */
+/* ======================= TYPES DEFINITIONS ====================== */
+/* ================================================================ */
+
+/**
+ * A link that is embedded into user elements instead of a separately allocated node
+*/
+typedef struct _ilink* ILink_t;
+
+/* ================================ */
+
+/**
+ * A data type that links user elements through their embedded links
+*/
+typedef struct _intrusive_list* IList_t;
+
+/* ================================ */
+
+/* ================================================================ */
+/* ====================== TYPES IMPLEMENTAION ===================== */
+/* ================================================================ */
+
+struct _ilink {
+    /* The link of the next element in the sequence */
+    struct _ilink* next;
+};
+
+struct _intrusive_list {
+    /* Number of elements in the list */
+    size_t size;
+
+    /* Link of the first element of the list */
+    struct _ilink* head;
+
+    /* Link of the last element of the list */
+    struct _ilink* tail;
+
+    /* Offset of the link inside an element */
+    size_t offset;
+
+    /* The encapsulated destroy function passed to IList_create */
+    destroy_fptr destroy;
+
+    /* The encapsulated print function passed to IList_create */
+    print_fptr print;
+
+    /* The encapsulated match function passed to IList_create */
+    match_fptr match;
+};
+
+/* ================================================================ */
+/* ========================== IList_t API ========================= */
+/* ================================================================ */
+
+/**
+ * Allocate a new instance of an intrusive list data type.
+ * All callbacks receive pointers to whole elements, not to their links.
+ *
+ * @param offset offset of the struct _ilink member inside an element, i.e. offsetof(type, member)
+ * @param destroy pointer to a function that handles the deletion of an element
+ * @param print pointer to a function that prints an element
+ * @param match a pointer to a function that compares elements
+ *
+ * @return a new instance of an intrusive list on success, NULL on failure.
+*/
+extern IList_t IList_create(size_t offset, destroy_fptr destroy, print_fptr print, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Output the content of an intrusive list.
+ *
+ * @param list list to be printed out
+ * @param print alternative print function used to handle elements
+ *
+ * @return none.
+*/
+extern void IList_print(const IList_t list, print_fptr print);
+
+/* ================================================================ */
+
+/**
+ * Link an element at the beginning of the list. No memory is allocated.
+ *
+ * @param list list to insert into
+ * @param element element to be inserted, its link must not be in use
+ *
+ * @return 0 on success, negative value on error.
+*/
+extern int IList_insert_first(const IList_t list, const Data element);
+
+/* ================================================================ */
+
+/**
+ * Link an element at the end of the list. No memory is allocated.
+ *
+ * @param list list to insert into
+ * @param element element to be inserted, its link must not be in use
+ *
+ * @return 0 on success, negative value on error.
+*/
+extern int IList_insert_last(const IList_t list, const Data element);
+
+/* ================================================================ */
+
+/**
+ * Find an element in the list that matches specified data (the first occurrence).
+ *
+ * @param list list to search in
+ * @param data data to be searched
+ * @param match alternative match function used to compare elements
+ *
+ * @return the matching element on success, NULL on failure.
+*/
+extern Data IList_find(const IList_t list, const Data data, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Remove the first element from the list
+ *
+ * @param list list to remove from
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int IList_remove_first(const IList_t list);
+
+/* ================================================================ */
+
+/**
+ * Remove the last element from the list
+ *
+ * @param list list to remove from
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int IList_remove_last(const IList_t list);
+
+/* ================================================================ */
+
+/**
+ * Remove the specified element from the list
+ *
+ * @param list list to remove from
+ * @param element element to be removed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int IList_remove(const IList_t list, const Data element);
+
+/* ================================================================ */
+
+/**
+ * Destroy the intrusive list.
+ *
+ * @param list list to be destroyed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int IList_destroy(IList_t* list);
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
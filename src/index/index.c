@@ -0,0 +1,352 @@
+#include "index.h"
+
+/* The table doubles when there are more entries than this many per bucket */
+#define INDEX_LOAD 2
+
+/* Bucket the hash falls into */
+#define INDEX_BUCKET(index, hash) ((hash) & ((index)->buckets - 1))
+
+/* ================================================================ */
+/* ============================ STATIC ============================ */
+/* ================================================================ */
+
+/**
+ * Move all entries into a new table with the given number of buckets.
+ *
+ * @param index index to resize
+ * @param buckets new number of buckets, a power of two
+ *
+ * @return 0 on success, negative value on failure.
+*/
+static int __Index_resize(const Index_t index, size_t buckets) {
+    /* =========== VARIABLES ========== */
+
+    /* Table we are creating */
+    struct _index_entry** table = NULL;
+
+    /* Entry that is being moved */
+    struct _index_entry* entry = NULL;
+
+    /* Entry that follows the moved one */
+    struct _index_entry* next = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ============ Dynamically allocate memory for a table =========== */
+    /* ================================================================ */
+
+    if ((table = (struct _index_entry**) calloc(buckets, sizeof(struct _index_entry*))) == NULL) {
+        LIST_WARN_SYS(__func__);
+
+        return -1;
+    }
+
+    /* ============ Cached hashes make rehashing call-free ============ */
+    for (size_t i = 0; i < index->buckets; i++) {
+
+        for (entry = index->table[i]; entry != NULL; entry = next) {
+            next = entry->next;
+
+            entry->next = table[entry->hash & (buckets - 1)];
+
+            table[entry->hash & (buckets - 1)] = entry;
+        }
+    }
+
+    free(index->table);
+
+    index->table = table;
+
+    index->buckets = buckets;
+
+    /* ================================= */
+
+    return 0;
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+Index_t Index_create(hash_fptr hash, size_t buckets) {
+    /* =========== VARIABLES ========== */
+
+    /* Index we are creating */
+    Index_t index = NULL;
+
+    /* Actual number of buckets */
+    size_t size = 1;
+
+    /* ================================= */
+
+
+
+    if (hash == NULL) {
+        LIST_WARN(__func__, "there is no `hash` function to use");
+
+        return NULL;
+    }
+
+    /* Round the number of buckets up to a power of two */
+    for (buckets = (buckets > 0) ? buckets : INDEX_DEFAULT_BUCKETS; size < buckets; size <<= 1) ;
+
+    /* ================================================================ */
+    /* =========== Dynamically allocate memory for an index =========== */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((index = (Index_t) malloc(sizeof(struct _index))) != NULL) {
+
+        /* Clear the memory/set some of the fields to its initial values */
+        memset(index, 0, sizeof(struct _index));
+
+        /* ================================= */
+
+        index->hash = hash;
+
+        index->buckets = size;
+
+        index->table = (struct _index_entry**) calloc(size, sizeof(struct _index_entry*));
+
+        index->pool = Pool_create(sizeof(struct _index_entry), 0);
+
+        if ((index->table == NULL) || (index->pool == NULL)) {
+            LIST_WARN_SYS(__func__);
+
+            Index_destroy(&index);
+        }
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return index;
+}
+
+/* ================================================================ */
+
+int Index_insert(const Index_t index, const Data key, void* item) {
+    /* =========== VARIABLES ========== */
+
+    /* Entry we are creating */
+    struct _index_entry* entry = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure an index is not NULL ================ */
+    /* ================================================================ */
+
+    if (index != NULL) {
+
+        /* Keep chains short */
+        if ((index->size >= index->buckets * INDEX_LOAD) && (__Index_resize(index, index->buckets * 2) != 0)) {
+            return result;
+        }
+
+        if ((entry = (struct _index_entry*) Pool_alloc(index->pool)) != NULL) {
+
+            /* =============== Cast to avoid a warning message ================ */
+            entry->key = (Data) key;
+
+            entry->item = item;
+
+            entry->hash = index->hash(key);
+
+            /* Push the entry onto its bucket */
+            entry->next = index->table[INDEX_BUCKET(index, entry->hash)];
+
+            index->table[INDEX_BUCKET(index, entry->hash)] = entry;
+
+            index->size++;
+
+            /* ================================= */
+
+            result = 0;
+        }
+
+        /* Pool_alloc function will tell you if there is an error occured while entry allocation */
+    }
+    else {
+        LIST_WARN(__func__, "provided index is NULL");
+    }
+
+    /* ================================= */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int Index_remove(const Index_t index, const Data key, const void* item) {
+    /* =========== VARIABLES ========== */
+
+    /* Link to the entry being checked */
+    struct _index_entry** link = NULL;
+
+    /* Entry to be removed */
+    struct _index_entry* entry = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure an index is not NULL ================ */
+    /* ================================================================ */
+
+    if (index != NULL) {
+
+        /* Items are unique, so the item pointer identifies the entry */
+        for (link = &index->table[INDEX_BUCKET(index, index->hash(key))]; (entry = *link) != NULL; link = &entry->next) {
+
+            if (entry->item == item) {
+
+                *link = entry->next;
+
+                Pool_free(index->pool, entry);
+
+                index->size--;
+
+                /* ================================= */
+
+                result = 0;
+
+                break ;
+            }
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided index is NULL");
+    }
+
+    /* ================================= */
+
+    return result;
+}
+
+/* ================================================================ */
+
+size_t Index_find(const Index_t index, const Data key, match_fptr match, void** items, size_t max) {
+    /* =========== VARIABLES ========== */
+
+    /* Entry we are using to traverse a bucket */
+    struct _index_entry* entry = NULL;
+
+    /* Hash of the key */
+    size_t hash = 0;
+
+    /* Number of matching items */
+    size_t count = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure an index is not NULL ================ */
+    /* ================================================================ */
+
+    if (index != NULL) {
+
+        hash = index->hash(key);
+
+        for (entry = index->table[INDEX_BUCKET(index, hash)]; entry != NULL; entry = entry->next) {
+
+            /* Cached hashes skip most of the match calls */
+            if ((entry->hash == hash) && (match(entry->key, key) == 0)) {
+
+                if ((items != NULL) && (count < max)) {
+                    items[count] = entry->item;
+                }
+
+                count++;
+            }
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided index is NULL");
+    }
+
+    /* ================================= */
+
+    return count;
+}
+
+/* ================================================================ */
+
+void Index_clear(const Index_t index) {
+
+    /* ================================================================ */
+    /* ================ Make sure an index is not NULL ================ */
+    /* ================================================================ */
+
+    if (index != NULL) {
+
+        /* Entries go away together with the pool chunks */
+        Pool_clear(index->pool);
+
+        memset(index->table, 0, index->buckets * sizeof(struct _index_entry*));
+
+        index->size = 0;
+    }
+    else {
+        LIST_WARN(__func__, "provided index is NULL");
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int Index_destroy(Index_t* index) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure an index is not NULL ================ */
+    /* ================================================================ */
+
+    if ((index != NULL) && (*index != NULL)) {
+
+        Pool_destroy(&(*index)->pool);
+
+        free((*index)->table);
+
+        /* Clear memory */
+        LIST_SCRUB(*index, sizeof(struct _index));
+
+        /* Deallocate memory */
+        free(*index);
+
+        *index = NULL;
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
@@ -0,0 +1,147 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../data/data.h"
+#include "../pool/pool.h"
+#include "../diagnostics/diagnostics.h"
+#include "../../guard/guard.h"
+
+/* Number of buckets when 0 is passed to Index_create */
+#define INDEX_DEFAULT_BUCKETS 64
+
+/* ================================================================ */
+/* ======================= TYPES DEFINITIONS ====================== */
+/* ================================================================ */
+
+/**
+ * A hash table that maps data keys to the items (e.g. list nodes) holding them
+*/
+typedef struct _index* Index_t;
+
+/* ================================ */
+
+/* ================================================================ */
+/* ====================== TYPES IMPLEMENTAION ===================== */
+/* ================================================================ */
+
+struct _index_entry {
+    /* The next entry in the same bucket */
+    struct _index_entry* next;
+
+    /* Cached hash of the key */
+    size_t hash;
+
+    /* Key the item is found by */
+    Data key;
+
+    /* Item holding the key */
+    void* item;
+};
+
+/* ================================ */
+
+struct _index {
+    /* Number of entries in the index */
+    size_t size;
+
+    /* Number of buckets, always a power of two */
+    size_t buckets;
+
+    /* Buckets of entries */
+    struct _index_entry** table;
+
+    /* Entries are taken from a private pool */
+    Pool_t pool;
+
+    /* The encapsulated hash function passed to Index_create */
+    hash_fptr hash;
+};
+
+/* ================================================================ */
+/* ========================= Index_t API ========================== */
+/* ================================================================ */
+
+/**
+ * Allocate a new instance of an index.
+ *
+ * @param hash pointer to a function that computes a hash of a key
+ * @param buckets initial number of buckets (rounded up to a power of two), INDEX_DEFAULT_BUCKETS if 0
+ *
+ * @return a new instance of an index on success, NULL on failure.
+*/
+extern Index_t Index_create(hash_fptr hash, size_t buckets);
+
+/* ================================================================ */
+
+/**
+ * Add an item with the key to the index. The table grows as needed.
+ *
+ * @param index index to insert into
+ * @param key key the item is found by
+ * @param item item to be stored
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int Index_insert(const Index_t index, const Data key, void* item);
+
+/* ================================================================ */
+
+/**
+ * Remove the item stored with the key from the index.
+ *
+ * @param index index to remove from
+ * @param key key the item was inserted with
+ * @param item item to be removed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int Index_remove(const Index_t index, const Data key, const void* item);
+
+/* ================================================================ */
+
+/**
+ * Find items whose keys match the key.
+ *
+ * @param index index to search in
+ * @param key key to be searched
+ * @param match function used to compare keys
+ * @param items array that receives matching items (in no particular order), may be NULL
+ * @param max capacity of the items array
+ *
+ * @return total number of matching items (may be greater than max).
+*/
+extern size_t Index_find(const Index_t index, const Data key, match_fptr match, void** items, size_t max);
+
+/* ================================================================ */
+
+/**
+ * Remove all entries from the index.
+ *
+ * @param index index to be cleared
+ *
+ * @return none.
+*/
+extern void Index_clear(const Index_t index);
+
+/* ================================================================ */
+
+/**
+ * Destroy the index. Keys and items are not touched.
+ *
+ * @param index index to be destroyed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int Index_destroy(Index_t* index);
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
@@ -1,25 +1,373 @@
 #include "list.h"
 
+/* Number of duplicate keys an indexed lookup resolves without comparing data, see List_index */
+#define LIST_INDEX_CANDIDATES 8
+
+/* Data of the node is a value stored in the node itself */
+#if LIST_INLINE_SIZE > 0
+    #define LIST_NODE_INLINE(node) ((node)->data == (Data) (node)->value)
+#else
+    #define LIST_NODE_INLINE(node) 0
+#endif
+
+/* Count events in the list statistics when the build asks for them. Lookups share the read lock, hence atomic adds */
+#ifdef LIST_STATS
+    #define LIST_STAT_ADD(list, counter, n) __atomic_fetch_add(&(list)->stats.counter, (n), __ATOMIC_RELAXED)
+
+    #define LIST_STAT_PEAK(list, size) if ((size) > (list)->stats.peak_size) (list)->stats.peak_size = (size)
+#else
+    #define LIST_STAT_ADD(list, counter, n) ((void) (n))
+
+    #define LIST_STAT_PEAK(list, size) ((void) (size))
+#endif
+
+/* Skip list levels of the list were built before its last change */
+#define LIST_SKIP_STALE(list) (((list)->skip != NULL) && ((list)->skip->changes != (list)->changes))
+
+/* Prefetch an address for reading, see LIST_PREFETCH_DISTANCE in list.h */
+#if defined(__GNUC__) && (LIST_PREFETCH_DISTANCE > 0)
+    #define LIST_PREFETCH(addr) __builtin_prefetch((addr))
+#else
+    #define LIST_PREFETCH(addr) ((void) 0)
+#endif
+
+/* Take and release the lock of a concurrent list, plain lists have none */
+#define LIST_RDLOCK(list) if (((list) != NULL) && ((list)->lock != NULL)) pthread_rwlock_rdlock((list)->lock)
+
+#define LIST_WRLOCK(list) if (((list) != NULL) && ((list)->lock != NULL)) pthread_rwlock_wrlock((list)->lock)
+
+#define LIST_UNLOCK(list) if (((list) != NULL) && ((list)->lock != NULL)) pthread_rwlock_unlock((list)->lock)
+
+/* Rest of a sorted list taken apart by an ordered merge, see List_merge_sorted_n */
+struct _list_run {
+    /* The next node of the run */
+    Node_t node;
+
+    /* Position of the list the run comes from, runs of earlier lists go first on ties */
+    size_t source;
+};
+
+/* Node layout of this build, see LIST_LAYOUT_SYMBOL */
+const int LIST_LAYOUT_SYMBOL(LIST_INLINE_SIZE) = LIST_INLINE_SIZE;
+
 /* ================================================================ */
 /* ============================ STATIC ============================ */
 /* ================================================================ */
 
+/**
+ * Start prefetching for a traversal that begins at the node. The returned node (the runner) walks
+ * LIST_PREFETCH_DISTANCE positions ahead of the traversal, so its memory is requested early.
+ * 
+ * @param node node the traversal begins at
+ * 
+ * @return the runner, NULL if the list is shorter or prefetching is disabled.
+*/
+static inline Node_t __List_prefetch_start(Node_t node) {
+
+#if LIST_PREFETCH_DISTANCE > 0
+    for (size_t i = 0; (i < LIST_PREFETCH_DISTANCE) && (node != NULL); i++) {
+
+        node = node->next;
+
+        LIST_PREFETCH(node);
+    }
+
+    return node;
+#else
+    return NULL;
+#endif
+}
+
+/* ================================================================ */
+
+/**
+ * Move the runner one node forward together with the traversal.
+ * 
+ * @param ahead the runner
+ * @param data non-zero if the traversal reads data, which is then prefetched as well
+ * 
+ * @return the new runner.
+*/
+static inline Node_t __List_prefetch_step(Node_t ahead, int data) {
+
+    if (ahead != NULL) {
+
+#ifndef LIST_NO_PREFETCH_DATA
+        if (data) {
+            LIST_PREFETCH(ahead->data);
+        }
+#endif
+
+        ahead = ahead->next;
+
+        LIST_PREFETCH(ahead);
+    }
+
+    return ahead;
+}
+
+/* ================================================================ */
+
+/**
+ * Give the node memory back to where it was taken from.
+ * 
+ * @param list list the node belongs to
+ * @param node node to be released
+ * 
+ * @return none.
+*/
+static void __Node_free(const List_t list, const Node_t node) {
+
+    /* Clear memory */
+    LIST_SCRUB(node, sizeof(struct _node));
+
+    /* Deallocate memory or give the node back to the pool */
+    if (list->pool != NULL) {
+        Pool_free(list->pool, node);
+    }
+    else {
+        free(node);
+    }
+
+    LIST_STAT_ADD(list, freed, 1);
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+/**
+ * Add nodes to the list index. Either all nodes are added or none.
+ * 
+ * @param list list with an index
+ * @param first the first node to be added
+ * @param stop node that follows the last node to be added
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+static int __List_index_nodes(const List_t list, const Node_t first, const Node_t stop) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are adding */
+    Node_t node = NULL;
+
+    /* Node that failed to be added */
+    Node_t failed = NULL;
+
+    /* ================================= */
+
+
+
+    for (node = first; node != stop; node = node->next) {
+
+        if (Index_insert(list->index, node->data, node) != 0) {
+            failed = node;
+
+            break ;
+        }
+    }
+
+    /* ========================= Roll back ============================ */
+    if (failed != NULL) {
+
+        for (node = first; node != failed; node = node->next) {
+            Index_remove(list->index, node->data, node);
+        }
+
+        return -1;
+    }
+
+    /* ================================= */
+
+    return 0;
+}
+
+/* ================================================================ */
+
+/**
+ * Create a new node for the list, taking it from the list pool if there is one.
+ * The node is registered in the list index if there is one.
+ * 
+ * @param list list the node is created for
+ * @param data data to be inserted into a new node, or the value to be copied into it
+ * @param size size of the value copied into the node (at most LIST_INLINE_SIZE), 0 to store the data pointer
+ * 
+ * @return A new instance of a node on success, NULL on failure.
+*/
+static Node_t __Node_alloc(const List_t list, const Data data, size_t size) {
+    /* =========== VARIABLES ========== */
+
+    Node_t node = NULL;
+
+    /* ================================= */
+
+
+
+    if (list->pool == NULL) {
+        node = Node_create(data);
+    }
+
+    /* ================================================================ */
+    /* ================ Take a node from the list pool ================ */
+    /* ================================================================ */
+
+    else if ((node = (Node_t) Pool_alloc(list->pool)) != NULL) {
+
+        /* =============== Cast to avoid a warning message ================ */
+        node->data = (Data) data;
+
+        node->next = NULL;
+    }
+
+    /* Node_create and Pool_alloc functions will tell you if there is an error occured while node allocation */
+
+#if LIST_INLINE_SIZE > 0
+    /* Small values live in the node, so they need no allocation of their own */
+    if ((node != NULL) && (size > 0)) {
+        node->data = (Data) memcpy(node->value, data, size);
+    }
+#else
+    (void) size;
+#endif
+
+    /* ================================================================ */
+    /* ================== Register the node in the index ============== */
+    /* ================================================================ */
+
+    if ((node != NULL) && (list->index != NULL) && (Index_insert(list->index, node->data, node) != 0)) {
+
+        __Node_free(list, node);
+
+        node = NULL;
+    }
+
+    /* Every new node is about to be linked into the list */
+    if (node != NULL) {
+        list->changes++;
+
+        LIST_STAT_ADD(list, allocated, 1);
+
+        LIST_STAT_PEAK(list, list->size + 1);
+    }
+
+    /* ================================= */
+
+    return node;
+}
+
+/* ================================================================ */
+
+/**
+ * Create a chain of nodes holding the data in array order. Either all nodes are created or none.
+ * 
+ * @param list list the nodes are created for
+ * @param data array of data to be inserted into new nodes
+ * @param n number of elements in the array (greater than 0)
+ * @param last where to store the last node of the chain
+ * 
+ * @return the first node of the chain on success, NULL on failure.
+*/
+static Node_t __Node_alloc_chain(const List_t list, const Data* data, size_t n, Node_t* last) {
+    /* =========== VARIABLES ========== */
+
+    /* The first node of the chain */
+    Node_t first = NULL;
+
+    /* Node we are creating */
+    Node_t node = NULL;
+
+    /* Node that precedes the one we are creating */
+    Node_t prev = NULL;
+
+    size_t i = 0;
+
+    /* ================================= */
+
+
+
+    /* Take all nodes of a pooled list from one contiguous chunk */
+    if ((list->pool != NULL) && (Pool_reserve(list->pool, n) != 0)) {
+        return NULL;
+    }
+
+    list->changes++;
+
+    /* ================================================================ */
+    /* ============== Create and link nodes in one pass =============== */
+    /* ================================================================ */
+
+    for (i = 0; i < n; i++) {
+
+        node = (list->pool != NULL) ? (Node_t) Pool_alloc_reserved(list->pool) : (Node_t) malloc(sizeof(struct _node));
+
+        if (node == NULL) {
+            LIST_WARN_SYS(__func__);
+
+            break ;
+        }
+
+        /* =============== Cast to avoid a warning message ================ */
+        node->data = (Data) data[i];
+
+        if (prev != NULL) {
+            prev->next = node;
+        }
+        else {
+            first = node;
+        }
+
+        prev = node;
+    }
+
+    if (prev != NULL) {
+        prev->next = NULL;
+    }
+
+    LIST_STAT_ADD(list, allocated, i);
+
+    /* ================================================================ */
+    /* ================ Roll back a partially made chain ============== */
+    /* ================================================================ */
+
+    if ((i < n) || ((list->index != NULL) && (__List_index_nodes(list, first, NULL) != 0))) {
+
+        for (; first != NULL; first = node) {
+            node = first->next;
+
+            __Node_free(list, first);
+        }
+
+        return NULL;
+    }
+
+    LIST_STAT_PEAK(list, list->size + n);
+
+    /* ================================= */
+
+    *last = prev;
+
+    return first;
+}
+
+/* ================================================================ */
+
 /**
  *  Destroy the node.
  * 
+ * @param list list the node belongs to
  * @param node pointer to the Node_t node to be destroyed
  * @param caller_name name of the function that calls a Node_destroy function or NULL
  * 
- * @return a pointer to data to be deleted.
+ * @return a pointer to data to be deleted, NULL if the data was a value stored in the node.
 */
-static Data __Node_destroy(Node_t* node, const char* func_name) {
+static Data __Node_destroy(const List_t list, Node_t* node, const char* func_name) {
     /* =========== VARIABLES ========== */
 
     /* Data to be destroyed */
     Data data = NULL;
 
-    int result = 1;
-
     /* ================================= */
 
 
@@ -33,20 +381,24 @@ static Data __Node_destroy(Node_t* node, const char* func_name) {
         /* Store data */
         data = (*node)->data;
 
-        /* Clear memory */
-        memset(*node, 0, sizeof(struct _node));
+        /* Forget the node in the index */
+        if (list->index != NULL) {
+            Index_remove(list->index, data, *node);
+        }
 
-        /* Deallocate memory */
-        free(*node);
+        /* A value stored in the node goes away with it */
+        if (LIST_NODE_INLINE(*node)) {
+            data = NULL;
+        }
 
-        *node = NULL;
+        __Node_free(list, *node);
 
-        /* ================================= */
+        list->changes++;
 
-        result = 0;
+        *node = NULL;
     }
     else {
-        warn_with_user_msg((func_name == NULL) ? __func__ : func_name, "provided node is NULL");
+        LIST_WARN((func_name == NULL) ? __func__ : func_name, "provided node is NULL");
     }
 
     /* ================================= */
@@ -54,149 +406,3486 @@ static Data __Node_destroy(Node_t* node, const char* func_name) {
     return data;
 }
 
-/* ================================================================ */
-/* ============================ EXTERN ============================ */
 /* ================================================================ */
 
-Node_t Node_create(const Data data) {
+/**
+ * Release all nodes of the list in a single walk, destroying their data if needed.
+ * The list is left empty. Nodes of a pool owned by the list alone are not released one by one,
+ * the pool is cleared at once instead.
+ * 
+ * @param list list to be emptied
+ * 
+ * @return none.
+*/
+static void __List_release_nodes(const List_t list) {
     /* =========== VARIABLES ========== */
 
-    Node_t node = NULL;
+    /* Node that is being released */
+    Node_t node = list->head;
 
-    /* ================================= */
+    /* Node that follows the released one */
+    Node_t next = NULL;
 
+    /* Nodes go away together with the pool */
+    int bulk = (list->pool != NULL) && (list->pool->refs == 1);
 
-    
-    /* ================================================================ */
-    /* ====== Dynamically allocate memory for a linked list node ====== */
-    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
-    /* ================================================================ */
+    /* ================================ */
 
-    if ((node = (Node_t) malloc(sizeof(struct _node))) != NULL) {
 
-        /* =============== Cast to avoid a warning message ================ */
-        node->data = (Data) data;
 
-        node->next = NULL;
+    for (; node != NULL; node = next) {
+
+        next = node->next;
+
+        /* Destroy data if needed, values stored in nodes have nothing to destroy */
+        if ((list->destroy != NULL) && !LIST_NODE_INLINE(node)) {
+            list->destroy(node->data);
+        }
+
+        if (!bulk) {
+            __Node_free(list, node);
+        }
     }
-    else {
-        warn_with_sys_msg(__func__);
+
+    if (bulk) {
+        Pool_clear(list->pool);
+
+        LIST_STAT_ADD(list, freed, list->size);
     }
 
-    /* ================================= */
+    if (list->index != NULL) {
+        Index_clear(list->index);
+    }
 
-    return node;
+    list->head = list->tail = NULL;
+
+    list->size = 0;
+
+    list->changes++;
+
+    /* ================================ */
+
+    return ;
 }
 
 /* ================================================================ */
 
-List_t List_create(destroy_fptr destroy, print_fptr print, match_fptr match) {
+/**
+ * Find the first node with specified data through the list index.
+ * 
+ * @param list list with an index
+ * @param data data to be searched
+ * 
+ * @return node with the specified data on success, NULL on failure.
+*/
+static Node_t __List_find_indexed(const List_t list, const Data data) {
     /* =========== VARIABLES ========== */
 
-    /* List we are creating */
-    List_t list = NULL;
+    /* Nodes holding matching data, in no particular order */
+    void* candidates[LIST_INDEX_CANDIDATES];
+
+    /* Number of matching nodes */
+    size_t count = 0;
+
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
 
     /* ================================= */
 
 
 
+    count = Index_find(list->index, data, list->match, candidates, LIST_INDEX_CANDIDATES);
+
+    /* Every matching node the index holds counts as visited */
+    LIST_STAT_ADD(list, hops, count);
+
+    if (count <= 1) {
+        return (count == 1) ? (Node_t) candidates[0] : NULL;
+    }
+
     /* ================================================================ */
-    /* ======== Dynamically allocate memory for a linked list ========= */
-    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ======= Duplicates: the one closest to the head is the first === */
     /* ================================================================ */
 
-    if ((list = (List_t) malloc(sizeof(struct _linked_list))) != NULL) {
+    for (node = list->head; node != NULL; node = node->next, hops++) {
 
-        /* Clear the memory/set some of the fields to its initial values */
-        memset(list, 0, sizeof(struct _linked_list));
+        if (count > LIST_INDEX_CANDIDATES) {
 
-        /* ================================= */
+            /* Too many duplicates to remember, compare data instead */
+            if (list->match(node->data, data) == 0) {
+                break ;
+            }
+        }
+        else {
+
+            for (size_t i = 0; i < count; i++) {
+                if (candidates[i] == node) {
+                    LIST_STAT_ADD(list, hops, hops);
+
+                    return node;
+                }
+            }
+        }
+    }
+
+    LIST_STAT_ADD(list, hops, hops);
+
+    /* ================================= */
+
+    return node;
+}
+
+/* ================================================================ */
+
+/**
+ * Rebuild stale skip list levels of the list. They stay stale if they cannot be rebuilt.
+ * 
+ * @param list list with skip list levels (locked for writing)
+ * 
+ * @return none.
+*/
+static void __List_skip_sync(const List_t list) {
+
+    if (LIST_SKIP_STALE(list) && (Skip_build(list->skip, list->head) == 0)) {
+        list->skip->changes = list->changes;
+    }
+}
+
+/* ================================================================ */
+
+/**
+ * Find the first node with specified data through the skip list levels of a sorted list.
+ * 
+ * @param list list with up-to-date skip list levels
+ * @param data data to be searched
+ * 
+ * @return node with the specified data on success, NULL on failure.
+*/
+static Node_t __List_find_skipped(const List_t list, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    /* The last node ordered before data */
+    Node_t node = NULL;
+
+    /* Towers and nodes visited, for the list statistics */
+    size_t hops = 0;
+
+    /* ================================= */
+
+
+
+    node = Skip_search(list->skip, list->head, data, 0, NULL, &hops);
+
+    LIST_STAT_ADD(list, hops, hops);
+
+    node = (node != NULL) ? node->next : list->head;
+
+    /* ================================= */
+
+    return ((node != NULL) && (list->skip->order(node->data, data) == 0)) ? node : NULL;
+}
+
+/* ================================================================ */
+
+/**
+ * Restore the heap order of runs below the position, the run whose next node goes first is on top.
+ * 
+ * @param runs heap of runs
+ * @param count number of runs in the heap
+ * @param i position of the run that may be out of order
+ * @param order function that orders data
+ * 
+ * @return none.
+*/
+static void __List_runs_sift(struct _list_run* runs, size_t count, size_t i, match_fptr order) {
+    /* =========== VARIABLES ========== */
+
+    /* Run that is being moved down */
+    struct _list_run run = runs[i];
+
+    /* The child run that goes first */
+    size_t child = 0;
+
+    int cmp = 0;
+
+    /* ================================= */
+
+
+
+    for (; (child = 2 * i + 1) < count; i = child) {
+
+        if (child + 1 < count) {
+
+            cmp = order(runs[child + 1].node->data, runs[child].node->data);
+
+            if ((cmp < 0) || ((cmp == 0) && (runs[child + 1].source < runs[child].source))) {
+                child++;
+            }
+        }
+
+        cmp = order(runs[child].node->data, run.node->data);
+
+        if ((cmp > 0) || ((cmp == 0) && (runs[child].source > run.source))) {
+            break ;
+        }
+
+        runs[i] = runs[child];
+    }
+
+    runs[i] = run;
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+/**
+ * Forget the nodes of the list after they have been moved to another one. They are not released.
+ * 
+ * @param list list to be emptied
+ * 
+ * @return none.
+*/
+static void __List_forget_nodes(const List_t list) {
+
+    if (list->index != NULL) {
+        Index_clear(list->index);
+    }
+
+    list->head = list->tail = NULL;
+
+    list->size = 0;
+
+    list->changes++;
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+Node_t Node_create(const Data data) {
+    /* =========== VARIABLES ========== */
+
+    Node_t node = NULL;
+
+    /* ================================= */
+
+
+    
+    /* ================================================================ */
+    /* ====== Dynamically allocate memory for a linked list node ====== */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((node = (Node_t) malloc(sizeof(struct _node))) != NULL) {
+
+        /* =============== Cast to avoid a warning message ================ */
+        node->data = (Data) data;
+
+        node->next = NULL;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return node;
+}
+
+/* ================================================================ */
+
+List_t List_create(destroy_fptr destroy, print_fptr print, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    List_t list = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ======== Dynamically allocate memory for a linked list ========= */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((list = (List_t) malloc(sizeof(struct _linked_list))) != NULL) {
+
+        /* Clear the memory/set some of the fields to its initial values */
+        memset(list, 0, sizeof(struct _linked_list));
+
+        /* ================================= */
 
         list->destroy = destroy;
 
         list->print = print;
 
-        list->match = match;
+        list->match = match;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+List_t List_create_pooled(destroy_fptr destroy, print_fptr print, match_fptr match, const Pool_t pool) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    List_t list = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================= Make sure pool items fit a node ============== */
+    if ((pool != NULL) && (pool->item_size < sizeof(struct _node))) {
+        LIST_WARN(__func__, "pool items are too small to hold a list node");
+
+        return NULL;
+    }
+
+    /* ================================= */
+
+    if ((list = List_create(destroy, print, match)) != NULL) {
+
+        /* Share the given pool or create a private one */
+        list->pool = (pool != NULL) ? Pool_retain(pool) : Pool_create(sizeof(struct _node), 0);
+
+        if (list->pool == NULL) {
+            List_destroy(&list);
+        }
+    }
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+List_t List_create_concurrent(destroy_fptr destroy, print_fptr print, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    List_t list = NULL;
+
+    /* ================================= */
+
+
+
+    if ((list = List_create(destroy, print, match)) != NULL) {
+
+        /* ================================================================ */
+        /* ============ Dynamically allocate memory for a lock ============ */
+        /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+        /* ================================================================ */
+
+        if ((list->lock = (pthread_rwlock_t*) malloc(sizeof(pthread_rwlock_t))) == NULL) {
+            LIST_WARN_SYS(__func__);
+
+            List_destroy(&list);
+        }
+        else if (pthread_rwlock_init(list->lock, NULL) != 0) {
+            LIST_WARN(__func__, "failed to initialize the list lock");
+
+            free(list->lock);
+
+            list->lock = NULL;
+
+            List_destroy(&list);
+        }
+    }
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================= */
+
+/**
+ * Implementation of List_print that does not take the list lock.
+*/
+static void __List_print(const List_t list, print_fptr print) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative print function */
+    print_fptr alt_print = NULL;
+
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* ================================= */
+
+
+    
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ============= Make sure there is a function to use ============= */
+        if ((list->print == NULL) && (print == NULL)) {
+            LIST_WARN("List_print", "there is no associated `print` function with the given list");
+
+            LIST_STAT_ADD(list, failures, 1);
+
+            return ;
+        }
+
+        /* ================================= */
+
+        printf("[");
+
+        if (list->size > 0) {
+
+            /* Use alternative print function if provided */
+            alt_print = (print != NULL) ? print : list->print;
+
+            for (node = list->head, ahead = __List_prefetch_start(node); node != NULL; node = node->next, ahead = __List_prefetch_step(ahead, 1)) {
+
+                /* Print the node data */
+                alt_print(node->data);
+
+                if (node->next != NULL) {
+                    printf(", ");
+                }
+            }
+        }
+
+        printf("]\n");
+    }
+    else {
+        LIST_WARN("List_print", "provided list is NULL");
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+void List_print(const List_t list, print_fptr print) {
+
+    LIST_RDLOCK(list);
+
+    __List_print(list, print);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_insert_first that does not take the list lock.
+*/
+static int __List_insert_first(const List_t list, const Data data, size_t size) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we want to add */
+    Node_t node = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ====================== Create a new node  ====================== */
+        if ((node = __Node_alloc(list, data, size)) != NULL) {
+
+            switch (list->size) {
+
+                /* If the list is empty */
+                case 0:
+                    list->head = list->tail = node;
+
+                    break ;
+
+                /* If there are nodes in the list */
+                default:
+
+                    /* Connect a new node with the list head */
+                    node->next = list->head;
+
+                    /* Set a new node to be the head of the list */
+                    list->head = node;
+
+                    break ;
+            }
+
+            list->size++;
+
+            /* ================================= */
+
+            result = 0;
+        }
+
+        /* Node_create function will tell you if there is an error occured while node creation */
+    }
+    else {
+        LIST_WARN("List_insert_first", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_insert_first(const List_t list, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_insert_first(list, data, 0);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_insert_last that does not take the list lock.
+*/
+static int __List_insert_last(const List_t list, const Data data, size_t size) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we want to add */
+    Node_t node = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ====================== Create a new node  ====================== */
+        if ((node = __Node_alloc(list, data, size)) != NULL) {
+
+            /* If the list is empty */
+            switch (list->size) {
+                case 0:
+                    list->tail = list->head = node;
+
+                    break ;
+
+                default:
+
+                    list->tail->next = node;
+
+                    list->tail = node;
+
+                    break ;
+            }
+
+            list->size++;
+
+            /* ================================ */
+            
+            result = 0;
+        }
+
+        /* Node_create function will tell you if there is an error occured while node creation */
+    }
+    else {
+        LIST_WARN("List_insert_last", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_insert_last(const List_t list, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_insert_last(list, data, 0);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_insert_first_value(const List_t list, const void* value, size_t size) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================== Make sure the value fits a node ============= */
+    if ((value == NULL) || (size == 0) || (size > LIST_INLINE_SIZE)) {
+        LIST_WARN(__func__, "provided value is NULL or does not fit into a node (see LIST_INLINE_SIZE)");
+
+        return result;
+    }
+
+    /* ================================ */
+
+    LIST_WRLOCK(list);
+
+    /* =============== Cast to avoid a warning message ================ */
+    result = __List_insert_first(list, (Data) value, size);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_insert_last_value(const List_t list, const void* value, size_t size) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================== Make sure the value fits a node ============= */
+    if ((value == NULL) || (size == 0) || (size > LIST_INLINE_SIZE)) {
+        LIST_WARN(__func__, "provided value is NULL or does not fit into a node (see LIST_INLINE_SIZE)");
+
+        return result;
+    }
+
+    /* ================================ */
+
+    LIST_WRLOCK(list);
+
+    /* =============== Cast to avoid a warning message ================ */
+    result = __List_insert_last(list, (Data) value, size);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_insert_first_n that does not take the list lock.
+*/
+static int __List_insert_first_n(const List_t list, const Data* data, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    /* The first node of the new chain */
+    Node_t first = NULL;
+
+    /* The last node of the new chain */
+    Node_t last = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if ((data == NULL) && (n > 0)) {
+            LIST_WARN("List_insert_first_n", "provided array is NULL");
+
+            return result;
+        }
+
+        if (n == 0) {
+            return 0;
+        }
+
+        /* ==================== Create a chain of nodes =================== */
+        if ((first = __Node_alloc_chain(list, data, n, &last)) != NULL) {
+
+            /* Connect the chain with the list head */
+            last->next = list->head;
+
+            if (list->size == 0) {
+                list->tail = last;
+            }
+
+            list->head = first;
+
+            list->size += n;
+
+            /* ================================= */
+
+            result = 0;
+        }
+
+        /* __Node_alloc_chain function will tell you if there is an error occured while node creation */
+    }
+    else {
+        LIST_WARN("List_insert_first_n", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_insert_first_n(const List_t list, const Data* data, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_insert_first_n(list, data, n);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_insert_last_n that does not take the list lock.
+*/
+static int __List_insert_last_n(const List_t list, const Data* data, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    /* The first node of the new chain */
+    Node_t first = NULL;
+
+    /* The last node of the new chain */
+    Node_t last = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if ((data == NULL) && (n > 0)) {
+            LIST_WARN("List_insert_last_n", "provided array is NULL");
+
+            return result;
+        }
+
+        if (n == 0) {
+            return 0;
+        }
+
+        /* ==================== Create a chain of nodes =================== */
+        if ((first = __Node_alloc_chain(list, data, n, &last)) != NULL) {
+
+            /* Connect the chain with the list tail */
+            if (list->size == 0) {
+                list->head = first;
+            }
+            else {
+                list->tail->next = first;
+            }
+
+            list->tail = last;
+
+            list->size += n;
+
+            /* ================================= */
+
+            result = 0;
+        }
+
+        /* __Node_alloc_chain function will tell you if there is an error occured while node creation */
+    }
+    else {
+        LIST_WARN("List_insert_last_n", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_insert_last_n(const List_t list, const Data* data, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_insert_last_n(list, data, n);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+List_t List_from_array(destroy_fptr destroy, print_fptr print, match_fptr match, const Data* data, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    List_t list = NULL;
+
+    /* Pool holding exactly the nodes of the array */
+    Pool_t pool = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================ All nodes are allocated at once =============== */
+    if ((pool = Pool_create(sizeof(struct _node), n)) == NULL) {
+        return NULL;
+    }
+
+    if ((list = List_create_pooled(destroy, print, match, pool)) != NULL) {
+
+        if (List_insert_last_n(list, data, n) != 0) {
+            List_destroy(&list);
+        }
+    }
+
+    /* The list is the only owner of the pool from now on */
+    Pool_destroy(&pool);
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+List_t List_from_values(destroy_fptr destroy, print_fptr print, match_fptr match, const void* values, size_t size, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    List_t list = NULL;
+
+    /* Pool holding exactly the nodes of the array */
+    Pool_t pool = NULL;
+
+    /* ================================= */
+
+
+
+    if (((values == NULL) && (n > 0)) || (size == 0) || (size > LIST_INLINE_SIZE)) {
+        LIST_WARN(__func__, "provided values are NULL or do not fit into a node (see LIST_INLINE_SIZE)");
+
+        return NULL;
+    }
+
+    /* ================ All nodes are allocated at once =============== */
+    if ((pool = Pool_create(sizeof(struct _node), n)) == NULL) {
+        return NULL;
+    }
+
+    if ((list = List_create_pooled(destroy, print, match, pool)) != NULL) {
+
+        /* The list is not shared with anybody yet, so it is not locked */
+        for (size_t i = 0; i < n; i++) {
+
+            if (__List_insert_last(list, (Data) ((const unsigned char*) values + i * size), size) != 0) {
+                List_destroy(&list);
+
+                break ;
+            }
+        }
+    }
+
+    /* The list is the only owner of the pool from now on */
+    Pool_destroy(&pool);
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_find that does not take the list lock.
+*/
+static Node_t __List_find(const List_t list, const Data data, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative match function */
+    match_fptr alt_match = NULL;
+
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if (data != NULL) {
+
+            /* ============= Make sure there is a function to use ============= */
+            if ((list->match == NULL) && (match == NULL)) {
+                LIST_WARN("List_find", "there is no associated `match` function with the given list");
+
+                LIST_STAT_ADD(list, failures, 1);
+
+                return NULL;
+            }
+
+            /* ================================= */
+
+            /* Use alternative match function if provided */
+            alt_match = (match != NULL) ? match : list->match;
+
+            /* The index answers lookups made with the list own match function */
+            if ((list->index != NULL) && (alt_match == list->match)) {
+                return __List_find_indexed(list, data);
+            }
+
+            /* So do skip list levels made with the same function, while the list is sorted by it */
+            if ((list->skip != NULL) && (alt_match == list->skip->order) && !LIST_SKIP_STALE(list) && list->skip->sorted) {
+                return __List_find_skipped(list, data);
+            }
+
+            /* Traverse the list and compare its data */
+            for (node = list->head, ahead = __List_prefetch_start(node); (node != NULL) && (alt_match(node->data, data) != 0); node = node->next, ahead = __List_prefetch_step(ahead, 1), hops++) ;
+
+            LIST_STAT_ADD(list, hops, hops);
+        }
+    }
+    else {
+        LIST_WARN("List_find", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return node;
+}
+
+/* ================================================================ */
+
+Node_t List_find(const List_t list, const Data data, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    Node_t node = NULL;
+
+    /* ================================ */
+
+
+
+    LIST_RDLOCK(list);
+
+    /* Stale skip list levels that would answer the lookup are rebuilt first, under the write lock */
+    if ((list != NULL) && LIST_SKIP_STALE(list) && (((match != NULL) ? match : list->match) == list->skip->order)) {
+        LIST_UNLOCK(list);
+
+        LIST_WRLOCK(list);
+
+        __List_skip_sync(list);
+    }
+
+    node = __List_find(list, data, match);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return node;
+}
+
+/* ================================================================ */
+
+
+/**
+ * Implementation of List_find_int that does not take the list lock.
+*/
+static Node_t __List_find_int(const List_t list, int key) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* Keys are compared inline, there is no call per node. Nodes without data hold no key */
+        for (node = list->head, ahead = __List_prefetch_start(node); (node != NULL) && ((node->data == NULL) || (*((int*) node->data) != key)); node = node->next, ahead = __List_prefetch_step(ahead, 1), hops++) ;
+
+        LIST_STAT_ADD(list, hops, hops);
+    }
+    else {
+        LIST_WARN("List_find_int", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return node;
+}
+
+/* ================================================================ */
+
+Node_t List_find_int(const List_t list, int key) {
+    /* =========== VARIABLES ========== */
+
+    Node_t node = NULL;
+
+    /* ================================ */
+
+
+
+    LIST_RDLOCK(list);
+
+    node = __List_find_int(list, key);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return node;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_find_str that does not take the list lock.
+*/
+static Node_t __List_find_str(const List_t list, const char* key) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if (key != NULL) {
+
+            /* The first character rejects most nodes before strcmp is called. Nodes without data hold no key */
+            for (node = list->head, ahead = __List_prefetch_start(node); node != NULL; node = node->next, ahead = __List_prefetch_step(ahead, 1), hops++) {
+
+                if ((node->data != NULL) && (*((const char*) node->data) == *key) && (strcmp((const char*) node->data, key) == 0)) {
+                    break ;
+                }
+            }
+
+            LIST_STAT_ADD(list, hops, hops);
+        }
+    }
+    else {
+        LIST_WARN("List_find_str", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return node;
+}
+
+/* ================================================================ */
+
+Node_t List_find_str(const List_t list, const char* key) {
+    /* =========== VARIABLES ========== */
+
+    Node_t node = NULL;
+
+    /* ================================ */
+
+
+
+    LIST_RDLOCK(list);
+
+    node = __List_find_str(list, key);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return node;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_find_all that does not take the list lock.
+*/
+static size_t __List_find_all(const List_t list, const Data data, match_fptr match, Node_t* nodes, size_t max) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative match function */
+    match_fptr alt_match = NULL;
+
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    /* Number of matching nodes */
+    size_t count = 0;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if (data != NULL) {
+
+            /* ============= Make sure there is a function to use ============= */
+            if ((list->match == NULL) && (match == NULL)) {
+                LIST_WARN("List_find_all", "there is no associated `match` function with the given list");
+
+                LIST_STAT_ADD(list, failures, 1);
+
+                return 0;
+            }
+
+            /* ================================= */
+
+            /* Use alternative match function if provided */
+            alt_match = (match != NULL) ? match : list->match;
+
+            for (node = list->head, ahead = __List_prefetch_start(node); node != NULL; node = node->next, ahead = __List_prefetch_step(ahead, 1), hops++) {
+
+                if (alt_match(node->data, data) == 0) {
+
+                    /* Store as many nodes as fit, but count all of them */
+                    if ((nodes != NULL) && (count < max)) {
+                        nodes[count] = node;
+                    }
+
+                    count++;
+                }
+            }
+
+            LIST_STAT_ADD(list, hops, hops);
+        }
+    }
+    else {
+        LIST_WARN("List_find_all", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return count;
+}
+
+/* ================================================================ */
+
+size_t List_find_all(const List_t list, const Data data, match_fptr match, Node_t* nodes, size_t max) {
+    /* =========== VARIABLES ========== */
+
+    size_t count = 0;
+
+    /* ================================ */
+
+
+
+    LIST_RDLOCK(list);
+
+    count = __List_find_all(list, data, match, nodes, max);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return count;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_remove_first that does not take the list lock.
+*/
+static int __List_remove_first(const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Node to be deleted */
+    Node_t node = NULL;
+
+    /* Data to be deleted */
+    Data data = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            node = list->head;
+
+            /* Set a new list head */
+            list->head = node->next;
+
+            if (list->size == 1) {
+                list->tail = list->head = NULL;
+            }
+
+            /* Update the list size */
+            list->size--;
+
+            /* Destroy the node */
+            data = __Node_destroy(list, &node, "List_remove_first");
+
+            /* Destroy data if needed */
+            if ((list->destroy != NULL) && (data != NULL)) {
+                list->destroy(data);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN("List_remove_first", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_remove_first(const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_remove_first(list);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_remove_last that does not take the list lock.
+*/
+static int __List_remove_last(const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Node to be deleted */
+    Node_t node = NULL;
+
+    /* Node that is used to traverse the list */
+    Node_t temp = NULL;
+
+    /* Data to be deleted */
+    Data data = NULL;   
+
+    int result = -1;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
+
+    /* ================================ */
+
+    
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            node = list->tail;
+
+            /* Special case */
+            if (list->size == 1) {
+                list->tail = list->head = NULL;
+            }
+            /* Default case */
+            else {
+                
+                /* Traverse the list */
+                for (temp = list->head, ahead = __List_prefetch_start(temp); temp->next != list->tail; temp = temp->next, ahead = __List_prefetch_step(ahead, 0), hops++) ;
+
+                LIST_STAT_ADD(list, hops, hops);
+
+                /* Set a new list tail */
+                list->tail = temp;
+
+                temp->next = NULL;
+            }
+
+            list->size--;
+
+            /* Destroy the node */
+            data =  __Node_destroy(list, &node, "List_remove_last");
+
+            if ((list->destroy != NULL) && (data != NULL)) {
+                list->destroy(data);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN("List_remove_last", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_remove_last(const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_remove_last(list);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_destroy(List_t* list) {
+    /* =========== VARIABLES ========== */
+
+    /* Operation result */
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if ((list != NULL) && (*list != NULL)) {
+
+        /* Release all nodes in a single walk */
+        __List_release_nodes(*list);
+
+        Index_destroy(&(*list)->index);
+
+        Skip_destroy(&(*list)->skip);
+
+        /* Release the pool (or the reference to a shared one) */
+        Pool_destroy(&(*list)->pool);
+
+        /* Segment starts cached by parallel traversals */
+        free((*list)->segments);
+
+        /* Nobody may use the list any more, so the lock goes away too */
+        if ((*list)->lock != NULL) {
+            pthread_rwlock_destroy((*list)->lock);
+
+            free((*list)->lock);
+        }
+
+        /* Clear memory */
+        LIST_SCRUB(*list, sizeof(struct _linked_list));
+
+        /* Deallocate memory */
+        free(*list);
+
+        *list = NULL;
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_clear that does not take the list lock.
+*/
+static int __List_clear(const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Operation result */
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        __List_release_nodes(list);
+
+        /* ================================ */
+
+        result = 0;
+    }
+    else {
+        LIST_WARN("List_clear", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_clear(const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_clear(list);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_merge that does not take the list locks. The emptied `src` list is left alive.
+*/
+static int __List_merge(const List_t* dest, List_t* src) {
+    /* =========== VARIABLES ========== */
+
+    /* Node that is being moved */
+    Node_t node = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================== Make sure dest is not NULL ================== */
+    /* ================================================================ */
+
+    if ((dest != NULL) && (*dest != NULL)) {
+
+        /* ================================================================ */
+        /* ================== Make sure src is not NULL =================== */
+        /* ================================================================ */
+
+        if ((src != NULL) && (*src != NULL)) {
+
+            /* Nodes can be relinked only if both lists take them from the same place */
+            if ((*dest)->pool == (*src)->pool) {
+
+                if ((*src)->size > 0) {
+
+                    /* Nodes of src become searchable through the dest index */
+                    if (((*dest)->index != NULL) && (__List_index_nodes(*dest, (*src)->head, NULL) != 0)) {
+                        return result;
+                    }
+
+                    /* Add the src head to the tail of the dest list */
+                    if ((*dest)->size == 0) {
+                        (*dest)->head = (*src)->head;
+                    }
+                    else {
+                        (*dest)->tail->next = (*src)->head;
+                    }
+
+                    /* Make the tail of the src list to be the tail of the dest list */
+                    (*dest)->tail = (*src)->tail;
+
+                    /* Compute a new size */
+                    (*dest)->size += (*src)->size;
+
+                    (*dest)->changes++;
+
+                    (*src)->changes++;
+
+                    LIST_STAT_PEAK(*dest, (*dest)->size);
+                }
+            }
+            /* Otherwise data is moved into nodes owned by the dest list */
+            else {
+
+                while ((node = (*src)->head) != NULL) {
+
+                    if (__List_insert_last(*dest, node->data, LIST_NODE_INLINE(node) ? LIST_INLINE_SIZE : 0) != 0) {
+                        return result;
+                    }
+
+                    (*src)->head = node->next;
+
+                    (*src)->size--;
+
+                    /* Data now belongs to dest, so it is not destroyed */
+                    __Node_destroy(*src, &node, "List_merge");
+                }
+            }
+
+            /* ================================ */
+
+            /* After the merge, the `src` list is left empty */
+            __List_forget_nodes(*src);
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_merge(const List_t* dest, List_t* src) {
+    /* =========== VARIABLES ========== */
+
+    /* Locks are always taken in the same (address) order to avoid deadlocks */
+    List_t first = NULL;
+
+    List_t second = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    if ((dest == NULL) || (src == NULL) || (*dest == NULL) || (*src == NULL)) {
+        return __List_merge(dest, src);
+    }
+
+    if (*dest == *src) {
+        LIST_WARN(__func__, "a list cannot be merged into itself");
+
+        return result;
+    }
+
+    /* ================================ */
+
+    first = (*dest < *src) ? *dest : *src;
+
+    second = (*dest < *src) ? *src : *dest;
+
+    LIST_WRLOCK(first);
+
+    LIST_WRLOCK(second);
+
+    result = __List_merge(dest, src);
+
+    LIST_UNLOCK(second);
+
+    LIST_UNLOCK(first);
+
+    /* After the merge, the `src` list is eliminated */
+    if (result == 0) {
+        List_destroy(src);
+
+        *src = NULL;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Release nodes copied for the source lists of an ordered merge that take nodes from another place than dest.
+ * 
+ * @param dest the destination list
+ * @param src source lists
+ * @param chains nodes of every source list
+ * @param n number of source lists to release the copies of
+ * 
+ * @return none.
+*/
+static void __List_merge_drop(const List_t dest, const List_t* src, const struct _linked_list* chains, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    /* Node that is being released */
+    Node_t node = NULL;
+
+    Node_t next = NULL;
+
+    /* ================================= */
+
+
+
+    for (size_t i = 0; i < n; i++) {
+
+        if (src[i]->pool == dest->pool) {
+            continue ;
+        }
+
+        /* The copies hold data that still belongs to src, so it is not destroyed */
+        for (node = chains[i].head; node != NULL; node = next) {
+            next = node->next;
+
+            __Node_free((List_t) &chains[i], node);
+        }
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+/**
+ * Find the nodes every source list of an ordered merge brings in. Nodes are relinked if the lists take them
+ * from the same place (no pool or the same one), otherwise data is copied into new nodes of dest, as List_merge does.
+ * Either all copies are made or none, the source lists are not changed.
+ * 
+ * @param dest the destination list
+ * @param src source lists
+ * @param chains receives the nodes of every source list, zeroed by the caller
+ * @param n number of source lists
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+static int __List_merge_chains(const List_t dest, const List_t* src, struct _linked_list* chains, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    /* Node whose data is copied */
+    Node_t node = NULL;
+
+    /* ================================= */
+
+
+
+    for (size_t i = 0; i < n; i++) {
+
+        if (src[i]->pool == dest->pool) {
+            chains[i].head = src[i]->head;
+
+            chains[i].tail = src[i]->tail;
+
+            chains[i].size = src[i]->size;
+
+            continue ;
+        }
+
+        /* Copies are taken the way dest takes its nodes */
+        chains[i].pool = dest->pool;
+
+        for (node = src[i]->head; node != NULL; node = node->next) {
+
+            if (__List_insert_last(&chains[i], node->data, LIST_NODE_INLINE(node) ? LIST_INLINE_SIZE : 0) != 0) {
+                __List_merge_drop(dest, src, chains, i + 1);
+
+                return -1;
+            }
+        }
+    }
+
+    /* ================================= */
+
+    return 0;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_merge_sorted_n that does not take the list locks.
+*/
+static int __List_merge_sorted_n(const List_t dest, const List_t* src, size_t n, match_fptr order) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative order function */
+    match_fptr alt_order = NULL;
+
+    /* Heap of runs, one for every non-empty list */
+    struct _list_run* runs = NULL;
+
+    size_t count = 0;
+
+    /* Nodes every source list brings in, copies when the lists take nodes from different places */
+    struct _linked_list* chains = NULL;
+
+    /* Node taken from the first run */
+    Node_t node = NULL;
+
+    /* Merged chain */
+    Node_t head = NULL;
+    Node_t tail = NULL;
+
+    /* Number of nodes moved into dest */
+    size_t moved = 0;
+
+    size_t i = 0;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ============= Make sure there is a function to use ============= */
+    if ((alt_order = (order != NULL) ? order : dest->match) == NULL) {
+        LIST_WARN("List_merge_sorted", "there is no associated `match` function with the given list");
+
+        LIST_STAT_ADD(dest, failures, 1);
+
+        return result;
+    }
+
+    if ((runs = (struct _list_run*) malloc((n + 1) * sizeof(struct _list_run))) == NULL) {
+        LIST_WARN_SYS("List_merge_sorted");
+
+        return result;
+    }
+
+    if ((chains = (struct _linked_list*) calloc((n > 0) ? n : 1, sizeof(struct _linked_list))) == NULL) {
+        LIST_WARN_SYS("List_merge_sorted");
+
+        free(runs);
+
+        return result;
+    }
+
+    /* ================================================================ */
+    /* ===== Nodes must fit dest, data of others is copied first ====== */
+    /* ================================================================ */
+
+    if (__List_merge_chains(dest, src, chains, n) != 0) {
+        free(chains);
+
+        free(runs);
+
+        return result;
+    }
+
+    /* Nodes of src become searchable through the dest index */
+    for (i = 0; (dest->index != NULL) && (i < n); i++) {
+
+        if (__List_index_nodes(dest, chains[i].head, NULL) != 0) {
+
+            /* ========================= Roll back ============================ */
+            while (i-- > 0) {
+
+                for (node = chains[i].head; node != NULL; node = node->next) {
+                    Index_remove(dest->index, node->data, node);
+                }
+            }
+
+            __List_merge_drop(dest, src, chains, n);
+
+            free(chains);
+
+            free(runs);
+
+            return result;
+        }
+    }
+
+    /* ================================================================ */
+    /* ============ Take the first node of the first run ============== */
+    /* ================================================================ */
+
+    if (dest->head != NULL) {
+        runs[count].node = dest->head;
+
+        runs[count++].source = 0;
+    }
+
+    for (i = 0; i < n; i++) {
+
+        if (chains[i].head != NULL) {
+            runs[count].node = chains[i].head;
+
+            runs[count++].source = i + 1;
+        }
+
+        moved += chains[i].size;
+    }
+
+    for (i = count / 2; i-- > 0; ) {
+        __List_runs_sift(runs, count, i, alt_order);
+    }
+
+    while (count > 1) {
+
+        node = runs[0].node;
+
+        if (tail != NULL) {
+            tail->next = node;
+        }
+        else {
+            head = node;
+        }
+
+        tail = node;
+
+        /* The run goes on or leaves the heap */
+        if ((runs[0].node = node->next) == NULL) {
+            runs[0] = runs[--count];
+        }
+
+        __List_runs_sift(runs, count, 0, alt_order);
+    }
+
+    /* The last run is linked as a whole, its tail is the tail of its list */
+    if (count == 1) {
+
+        if (tail != NULL) {
+            tail->next = runs[0].node;
+        }
+        else {
+            head = runs[0].node;
+        }
+
+        tail = (runs[0].source == 0) ? dest->tail : chains[runs[0].source - 1].tail;
+    }
+
+    free(runs);
+
+    /* ================================ */
+
+    dest->head = head;
+
+    dest->tail = tail;
+
+    dest->size += moved;
+
+    dest->changes++;
+
+    LIST_STAT_PEAK(dest, dest->size);
+
+    for (i = 0; i < n; i++) {
+
+        /* Data now belongs to dest, so it is not destroyed with the nodes it was copied from */
+        if (src[i]->pool != dest->pool) {
+
+            LIST_STAT_ADD(dest, allocated, chains[i].size);
+
+            while ((node = src[i]->head) != NULL) {
+                src[i]->head = node->next;
+
+                __Node_destroy(src[i], &node, "List_merge_sorted");
+            }
+        }
+
+        __List_forget_nodes(src[i]);
+    }
+
+    free(chains);
+
+    /* ================================ */
+
+    result = 0;
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Compare lists by their addresses, the order their locks are taken in.
+*/
+static int __List_compare_addresses(const void* a, const void* b) {
+    return (*((const List_t*) a) > *((const List_t*) b)) - (*((const List_t*) a) < *((const List_t*) b));
+}
+
+/* ================================================================ */
+
+int List_merge_sorted_n(const List_t* dest, List_t* src, size_t n, match_fptr order) {
+    /* =========== VARIABLES ========== */
+
+    /* All lists of the merge, in the order their locks are taken in */
+    List_t* lists = NULL;
+
+    size_t i = 0;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ============== Make sure dest and src are not NULL ============= */
+    /* ================================================================ */
+
+    if ((dest == NULL) || (*dest == NULL) || ((src == NULL) && (n > 0))) {
+        LIST_WARN(__func__, "provided list is NULL");
+
+        return result;
+    }
+
+    for (i = 0; i < n; i++) {
+
+        if (src[i] == NULL) {
+            LIST_WARN(__func__, "provided list is NULL");
+
+            return result;
+        }
+    }
+
+    if ((lists = (List_t*) malloc((n + 1) * sizeof(List_t))) == NULL) {
+        LIST_WARN_SYS(__func__);
+
+        return result;
+    }
+
+    lists[0] = *dest;
+
+    memcpy(lists + 1, src, n * sizeof(List_t));
+
+    qsort(lists, n + 1, sizeof(List_t), __List_compare_addresses);
+
+    for (i = 0; i < n; i++) {
+
+        if (lists[i] == lists[i + 1]) {
+            LIST_WARN(__func__, "a list cannot be merged into itself");
+
+            free(lists);
+
+            return result;
+        }
+    }
+
+    /* ================================ */
+
+    for (i = 0; i <= n; i++) {
+        LIST_WRLOCK(lists[i]);
+    }
+
+    result = __List_merge_sorted_n(*dest, src, n, order);
+
+    for (i = n + 1; i-- > 0; ) {
+        LIST_UNLOCK(lists[i]);
+    }
+
+    free(lists);
+
+    /* After the merge, the `src` lists are eliminated */
+    for (i = 0; (result == 0) && (i < n); i++) {
+        List_destroy(&src[i]);
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_merge_sorted(const List_t* dest, List_t* src, match_fptr order) {
+
+    if (src == NULL) {
+        LIST_WARN(__func__, "provided list is NULL");
+
+        return -1;
+    }
+
+    return List_merge_sorted_n(dest, src, 1, order);
+}
+
+/* ================================================================ */
+
+int List_merge_keep(const List_t dest, const List_t src) {
+    /* =========== VARIABLES ========== */
+
+    /* Locks are always taken in the same (address) order to avoid deadlocks */
+    List_t first = (dest < src) ? dest : src;
+
+    List_t second = (dest < src) ? src : dest;
+
+    /* The source list, it is not eliminated */
+    List_t source = src;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    if ((dest == NULL) || (src == NULL)) {
+        LIST_WARN(__func__, "provided list is NULL");
+
+        return result;
+    }
+
+    if (dest == src) {
+        LIST_WARN(__func__, "a list cannot be merged into itself");
+
+        return result;
+    }
+
+    /* ================================ */
+
+    LIST_WRLOCK(first);
+
+    LIST_WRLOCK(second);
+
+    result = __List_merge(&dest, &source);
+
+    LIST_UNLOCK(second);
+
+    LIST_UNLOCK(first);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_merge_sorted_keep(const List_t dest, const List_t src, match_fptr order) {
+    /* =========== VARIABLES ========== */
+
+    /* Locks are always taken in the same (address) order to avoid deadlocks */
+    List_t first = (dest < src) ? dest : src;
+
+    List_t second = (dest < src) ? src : dest;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    if ((dest == NULL) || (src == NULL)) {
+        LIST_WARN(__func__, "provided list is NULL");
+
+        return result;
+    }
+
+    if (dest == src) {
+        LIST_WARN(__func__, "a list cannot be merged into itself");
+
+        return result;
+    }
+
+    /* ================================ */
+
+    LIST_WRLOCK(first);
+
+    LIST_WRLOCK(second);
+
+    result = __List_merge_sorted_n(dest, &src, 1, order);
+
+    LIST_UNLOCK(second);
+
+    LIST_UNLOCK(first);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_split_at that does not take the list lock.
+*/
+static List_t __List_split_at(const List_t list, const Node_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* List that receives the nodes after the given one */
+    List_t part = NULL;
+
+    /* Node we are using to traverse the moved nodes */
+    Node_t temp = NULL;
+
+    /* Number of moved nodes */
+    size_t count = 0;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list == NULL) {
+        LIST_WARN("List_split_at", "provided list is NULL");
+
+        return NULL;
+    }
+
+#ifdef LIST_DEBUG
+    /* Make sure the specified node is in the list */
+    for (temp = list->head; (node != NULL) && (temp != NULL) && (temp != node); temp = temp->next) ;
+
+    if ((node != NULL) && (temp == NULL)) {
+        LIST_WARN("List_split_at", "provided node is not in the list");
+
+        LIST_STAT_ADD(list, failures, 1);
+
+        return NULL;
+    }
+#endif
+
+    /* ================================================================ */
+    /* ==== A list of the same kind, sharing the pool of the nodes ==== */
+    /* ================================================================ */
+
+    part = (list->lock != NULL) ? List_create_concurrent(list->destroy, list->print, list->match) : List_create(list->destroy, list->print, list->match);
+
+    if (part == NULL) {
+        return NULL;
+    }
+
+    /* Concurrent lists have no pool, so a concurrent part never shares one */
+    if (list->pool != NULL) {
+        part->pool = Pool_retain(list->pool);
+    }
+
+    /* ================================================================ */
+    /* ====== An index and skip list levels made the same way ========= */
+    /* ================================================================ */
+
+    if (((list->index != NULL) && ((part->index = Index_create(list->index->hash, 0)) == NULL)) ||
+        ((list->skip != NULL) && ((part->skip = Skip_create(list->skip->order)) == NULL))) {
+
+        List_destroy(&part);
+
+        return NULL;
+    }
+
+    /* The moved nodes enter the new index before anything is changed, the levels are built on first use */
+    if ((part->index != NULL) && (__List_index_nodes(part, (node != NULL) ? node->next : list->head, NULL) != 0)) {
+        List_destroy(&part);
+
+        return NULL;
+    }
+
+    /* ================================ */
+
+    part->head = (node != NULL) ? node->next : list->head;
+
+    if (part->head != NULL) {
+
+        /* Moved nodes are counted and leave the list index on the way */
+        for (temp = part->head; temp != NULL; temp = temp->next, count++) {
+
+            if (list->index != NULL) {
+                Index_remove(list->index, temp->data, temp);
+            }
+        }
+
+        part->tail = list->tail;
+
+        part->size = count;
+
+        part->changes++;
+
+        LIST_STAT_PEAK(part, count);
+
+        /* The given node becomes the tail */
+        if (node != NULL) {
+            node->next = NULL;
+        }
+        else {
+            list->head = NULL;
+        }
+
+        list->tail = node;
+
+        list->size -= count;
+
+        list->changes++;
+    }
+
+    /* ================================ */
+
+    return part;
+}
+
+/* ================================================================ */
+
+List_t List_split_at(const List_t list, const Node_t node) {
+    /* =========== VARIABLES ========== */
+
+    List_t part = NULL;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    part = __List_split_at(list, node);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return part;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_splice that does not take the list locks.
+*/
+static int __List_splice(const List_t dest, const Node_t after, const List_t src, const Node_t prev, Node_t last) {
+    /* =========== VARIABLES ========== */
+
+    /* The first moved node and the one that follows the last moved node */
+    Node_t first = NULL;
+    Node_t stop = NULL;
+
+    /* Node we are using to traverse the range */
+    Node_t temp = NULL;
+
+    /* Number of moved nodes */
+    size_t count = 1;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ============ Nodes are relinked, so they must fit dest ========= */
+    /* ================================================================ */
+
+    if (dest->pool != src->pool) {
+        LIST_WARN("List_splice", "nodes of lists with different pools cannot be relinked");
+
+        return result;
+    }
+
+#ifdef LIST_DEBUG
+    /* Make sure the specified nodes are in their lists */
+    for (temp = dest->head; (after != NULL) && (temp != NULL) && (temp != after); temp = temp->next) ;
+
+    for (first = src->head; (prev != NULL) && (first != NULL) && (first != prev); first = first->next) ;
+
+    if (((after != NULL) && (temp == NULL)) || ((prev != NULL) && (first == NULL))) {
+        LIST_WARN("List_splice", "provided node is not in the list");
+
+        LIST_STAT_ADD(src, failures, 1);
+
+        return result;
+    }
+#endif
+
+    if ((first = (prev != NULL) ? prev->next : src->head) == NULL) {
+        LIST_WARN("List_splice", "there are no nodes after the given one");
+
+        LIST_STAT_ADD(src, failures, 1);
+
+        return result;
+    }
+
+    if (last == NULL) {
+        last = src->tail;
+    }
+
+    /* Count the range, making sure it ends with the last node */
+    for (temp = first; (temp != NULL) && (temp != last); temp = temp->next, count++) ;
+
+    if (temp == NULL) {
+        LIST_WARN("List_splice", "the last node does not follow the first one");
+
+        LIST_STAT_ADD(src, failures, 1);
+
+        return result;
+    }
+
+    stop = last->next;
+
+    /* ================================================================ */
+    /* ================= Move the range between indexes =============== */
+    /* ================================================================ */
+
+    if ((dest->index != NULL) && (__List_index_nodes(dest, first, stop) != 0)) {
+        return result;
+    }
+
+    for (temp = first; (src->index != NULL) && (temp != stop); temp = temp->next) {
+        Index_remove(src->index, temp->data, temp);
+    }
+
+    /* ================= Unlink the range from src ==================== */
+    if (prev != NULL) {
+        prev->next = stop;
+    }
+    else {
+        src->head = stop;
+    }
+
+    if (last == src->tail) {
+        src->tail = prev;
+    }
+
+    src->size -= count;
+
+    src->changes++;
+
+    /* ================== Link the range into dest ==================== */
+    if (after != NULL) {
+        last->next = after->next;
+
+        after->next = first;
+    }
+    else {
+        last->next = dest->head;
+
+        dest->head = first;
+    }
+
+    if ((after == dest->tail) || (dest->tail == NULL)) {
+        dest->tail = last;
+    }
+
+    dest->size += count;
+
+    dest->changes++;
+
+    LIST_STAT_PEAK(dest, dest->size);
+
+    /* ================================ */
+
+    result = 0;
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_splice(const List_t dest, const Node_t after, const List_t src, const Node_t prev, const Node_t last) {
+    /* =========== VARIABLES ========== */
+
+    /* Locks are always taken in the same (address) order to avoid deadlocks */
+    List_t first = (dest < src) ? dest : src;
+
+    List_t second = (dest < src) ? src : dest;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    if ((dest == NULL) || (src == NULL)) {
+        LIST_WARN(__func__, "provided list is NULL");
+
+        return result;
+    }
+
+    if (dest == src) {
+        LIST_WARN(__func__, "nodes cannot be spliced into the list they are taken from");
+
+        return result;
+    }
+
+    /* ================================ */
+
+    LIST_WRLOCK(first);
+
+    LIST_WRLOCK(second);
+
+    result = __List_splice(dest, after, src, prev, last);
+
+    LIST_UNLOCK(second);
+
+    LIST_UNLOCK(first);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_remove_node that does not take the list lock.
+*/
+static int __List_remove_node(const List_t list, Node_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* Node that is used to traverse the list */
+    Node_t temp = NULL;
+
+    Data data = NULL;
+
+    int result = -1;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a node is not NULL ================= */
+    /* ================================================================ */
+
+    if (node == NULL) {
+        return result;
+    }
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            /* Case 1. Remove the head */
+            if (node == list->head) {
+                __List_remove_first(list);
+            }
+
+            /* Case 2. Remove the tail */
+            else if (node == list->tail) {
+                __List_remove_last(list);
+            }
+
+            /* Case 3. Somewhere in between head and tail */
+            else {
+
+                /* Make sure the specified node is in the list */
+                for (temp = list->head, ahead = __List_prefetch_start(temp); temp != NULL && temp->next != node; temp = temp->next, ahead = __List_prefetch_step(ahead, 0), hops++) ;
+
+                LIST_STAT_ADD(list, hops, hops);
+
+                /* The node IS in the list */
+                if (temp != NULL) {
+
+                    temp->next = temp->next->next;
+
+                    list->size--;
+
+                    data = __Node_destroy(list, &node, "List_remove_node");
+
+                    if ((list->destroy != NULL) && (data != NULL)) {
+                        list->destroy(data);
+                    }
+                }
+                else {
+                    LIST_STAT_ADD(list, failures, 1);
+                }
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN("List_remove_node", "provided list is NULL");
+    }
+
+    /* ================================ */
+    
+    return result;
+}
+
+/* ================================================================ */
+
+int List_remove_node(const List_t list, Node_t node) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_remove_node(list, node);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_insert_after that does not take the list lock.
+*/
+static int __List_insert_after(const List_t list, const Data data, const Node_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* Node that is used to traverse the list */
+    Node_t temp = NULL;
+
+    /* Node we are creating */
+    Node_t new_node = NULL;
+
+    int result = -1;
+
+#ifdef LIST_DEBUG
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
+#endif
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================== Make sure list is not NULL ================== */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* Special case. When there is no any node in the list */
+        if ((list->size == 0) || (node == NULL) || (node == list->tail)) {
+            result = __List_insert_last(list, data, 0);
+        }
+
+        /* Default case  */
+        else {
+
+            /* ====================== Create a new node  ====================== */
+            if ((new_node = __Node_alloc(list, data, 0)) != NULL) {
+
+#ifdef LIST_DEBUG
+                /* Make sure the specified node is in the list */
+                for (temp = list->head; temp != NULL && temp != node; temp = temp->next, hops++) ;
+
+                LIST_STAT_ADD(list, hops, hops);
+#else
+                /* The caller guarantees the node is in the list */
+                temp = node;
+#endif
+
+                /* The node IS in the list */
+                if (temp != NULL) {
+
+                    new_node->next = temp->next;
+
+                    temp->next = new_node;
+
+                    list->size++;
+
+                    /* ================================ */
+
+                    result = 0;
+                }
+                /* If the list doesn't contain such a node */
+                else {
+                    LIST_STAT_ADD(list, failures, 1);
+
+                    __Node_destroy(list, &new_node, "List_insert_after");
+
+                    if (list->destroy != NULL) {
+                        list->destroy(data);
+                    }
+                }
+            }
+        }
+    }
+    else {
+        LIST_WARN("List_insert_after", "provided list is NULL");
+    }
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_insert_after(const List_t list, const Data data, const Node_t node) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_insert_after(list, data, node);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_insert_before that does not take the list lock.
+*/
+static int __List_insert_before(const List_t list, const Data data, const Node_t node) {
+    /* =========== VARIABLES ========== */
+
+    /* Node that is used to traverse the list */
+    Node_t temp = NULL;
+
+    /* Node we are creating */
+    Node_t new_node = NULL;
+
+    int result = -1;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================== Make sure list is not NULL ================== */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+         /* Special case. When there is no any node in the list */
+        if ((list->size == 0) || (node == NULL) || (node == list->head)) {
+            result = __List_insert_first(list, data, 0);
+        }
+        else {
+            
+            /* ====================== Create a new node  ====================== */
+            if ((new_node = __Node_alloc(list, data, 0)) != NULL) {
+
+                /* Make sure the specified node is in the list */
+                for (temp = list->head; (temp != NULL) && (temp->next != node); temp = temp->next, hops++) ;
+
+                LIST_STAT_ADD(list, hops, hops);
+
+                /* The node IS in the list */
+                if (temp != NULL) {
+
+                    new_node->next = temp->next;
+
+                    temp->next = new_node;
+
+                    list->size++;
+
+                    /* ================================ */
+                    
+                    result = 0;
+                }
+                /* Node is not in the list */
+                else {
+                    LIST_STAT_ADD(list, failures, 1);
+
+                    __Node_destroy(list, &new_node, "List_insert_before");
+
+                    if (list->destroy != NULL) {
+                        list->destroy(data);
+                    }
+                }
+            }
+        }
+    }
+    else {
+        LIST_WARN("List_insert_before", "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_insert_before(const List_t list, const Data data, const Node_t node) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_insert_before(list, data, node);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_cursor_init(const Cursor_t cursor, const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ============ Make sure a cursor and a list are not NULL ======== */
+    /* ================================================================ */
+
+    if ((cursor != NULL) && (list != NULL)) {
+
+        cursor->list = list;
+
+        /* Stand on the head, nothing precedes it */
+        cursor->prev = NULL;
+
+        cursor->node = list->head;
+
+        /* ================================ */
+
+        result = 0;
+    }
+    else {
+        LIST_WARN(__func__, "provided cursor or list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+Node_t List_cursor_next(const Cursor_t cursor) {
+
+    /* ================================================================ */
+    /* ================ Make sure a cursor is not NULL ================ */
+    /* ================================================================ */
+
+    if (cursor != NULL) {
+
+        /* Step forward unless the cursor is already past the end */
+        if (cursor->node != NULL) {
+
+            cursor->prev = cursor->node;
+
+            cursor->node = cursor->node->next;
+        }
+
+        return cursor->node;
+    }
+    else {
+        LIST_WARN(__func__, "provided cursor is NULL");
+    }
+
+    /* ================================ */
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int List_cursor_remove(const Cursor_t cursor) {
+    /* =========== VARIABLES ========== */
+
+    /* List the cursor walks through */
+    List_t list = NULL;
+
+    /* Node to be deleted */
+    Node_t node = NULL;
+
+    /* Data to be deleted */
+    Data data = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure a cursor is not NULL ================ */
+    /* ================================================================ */
+
+    if ((cursor != NULL) && (cursor->node != NULL)) {
+
+        list = cursor->list;
+
+        node = cursor->node;
+
+#ifdef LIST_DEBUG
+        /* Make sure the list has not been changed behind the cursor */
+        if (((cursor->prev != NULL) ? cursor->prev->next : list->head) != node) {
+            LIST_WARN(__func__, "the cursor is out of sync with the list");
+
+            LIST_STAT_ADD(list, failures, 1);
+
+            return result;
+        }
+#endif
+
+        /* Bypass the node, the predecessor is already known */
+        if (cursor->prev != NULL) {
+            cursor->prev->next = node->next;
+        }
+        else {
+            list->head = node->next;
+        }
+
+        if (node == list->tail) {
+            list->tail = cursor->prev;
+        }
+
+        list->size--;
+
+        /* The cursor moves on to the node that followed the removed one */
+        cursor->node = node->next;
+
+        data = __Node_destroy(list, &node, __func__);
+
+        /* Destroy data if needed */
+        if ((list->destroy != NULL) && (data != NULL)) {
+            list->destroy(data);
+        }
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_cursor_insert_before(const Cursor_t cursor, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    /* List the cursor walks through */
+    List_t list = NULL;
+
+    /* Node we are creating */
+    Node_t new_node = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure a cursor is not NULL ================ */
+    /* ================================================================ */
+
+    if (cursor != NULL) {
+
+        list = cursor->list;
+
+        /* ====================== Create a new node  ====================== */
+        if ((new_node = __Node_alloc(list, data, 0)) != NULL) {
+
+            /* Link the new node between the predecessor and the current node */
+            new_node->next = cursor->node;
+
+            if (cursor->prev != NULL) {
+                cursor->prev->next = new_node;
+            }
+            else {
+                list->head = new_node;
+            }
+
+            if (cursor->node == NULL) {
+                list->tail = new_node;
+            }
+
+            list->size++;
+
+            /* The new node is the predecessor of the current one now */
+            cursor->prev = new_node;
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided cursor is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_cursor_insert_after(const Cursor_t cursor, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    /* List the cursor walks through */
+    List_t list = NULL;
+
+    /* Node we are creating */
+    Node_t new_node = NULL;
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================ Make sure a cursor is not NULL ================ */
+    /* ================================================================ */
+
+    if (cursor != NULL) {
+
+        /* Past the end, inserting after is the same as inserting before */
+        if (cursor->node == NULL) {
+            return List_cursor_insert_before(cursor, data);
+        }
+
+        list = cursor->list;
+
+        /* ====================== Create a new node  ====================== */
+        if ((new_node = __Node_alloc(list, data, 0)) != NULL) {
+
+            new_node->next = cursor->node->next;
+
+            cursor->node->next = new_node;
+
+            if (cursor->node == list->tail) {
+                list->tail = new_node;
+            }
+
+            list->size++;
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided cursor is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/* ================================================================ */
+
+int List_iter_init(const Iterator_t iter, const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ========= Make sure an iterator and a list are not NULL ======== */
+    /* ================================================================ */
+
+    if ((iter != NULL) && (list != NULL)) {
+
+        iter->node = list->head;
+
+        /* ================================ */
+
+        result = 0;
+    }
+    else {
+        LIST_WARN(__func__, "provided iterator or list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_iter_next(const Iterator_t iter, Data* data) {
+
+    /* ================================================================ */
+    /* =============== Make sure an iterator is not NULL ============== */
+    /* ================================================================ */
+
+    if ((iter == NULL) || (data == NULL)) {
+        LIST_WARN(__func__, "provided iterator or data pointer is NULL");
+
+        return -1;
+    }
+
+    /* The end of the list */
+    if (iter->node == NULL) {
+        return -1;
+    }
+
+    /* ================================ */
+
+    *data = iter->node->data;
+
+    iter->node = iter->node->next;
+
+    /* The caller works on the data while the next node is being fetched */
+    LIST_PREFETCH(iter->node);
+
+    /* ================================ */
+
+    return 0;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_for_each that does not take the list lock.
+*/
+static int __List_for_each(const List_t list, visit_fptr visit, void* arg) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    int result = -1;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if ((list != NULL) && (visit != NULL)) {
+
+        for (node = list->head, ahead = __List_prefetch_start(node); node != NULL; node = node->next, ahead = __List_prefetch_step(ahead, 1)) {
+            visit(node->data, arg);
+        }
+
+        /* ================================ */
+
+        result = 0;
+    }
+    else {
+        LIST_WARN("List_for_each", "provided list or function is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_for_each(const List_t list, visit_fptr visit, void* arg) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    LIST_RDLOCK(list);
+
+    result = __List_for_each(list, visit, arg);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_to_array that does not take the list lock.
+*/
+static size_t __List_to_array(const List_t list, Data* array, size_t max) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    size_t count = 0;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list == NULL) {
+        LIST_WARN("List_to_array", "provided list is NULL");
+
+        return count;
+    }
+
+    if (array == NULL) {
+        max = 0;
+    }
+
+    /* Only pointers are copied, so data is not prefetched */
+    for (node = list->head, ahead = __List_prefetch_start(node); (node != NULL) && (count < max); node = node->next, ahead = __List_prefetch_step(ahead, 0)) {
+        array[count++] = node->data;
+    }
+
+    /* ================================ */
+
+    return list->size;
+}
+
+/* ================================================================ */
+
+size_t List_to_array(const List_t list, Data* array, size_t max) {
+    /* =========== VARIABLES ========== */
+
+    size_t count = 0;
+
+    /* ================================ */
+
+
+
+    LIST_RDLOCK(list);
+
+    count = __List_to_array(list, array, max);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return count;
+}
+
+/* ================================================================ */
+
+Data* List_to_array_alloc(const List_t list, size_t* count) {
+    /* =========== VARIABLES ========== */
+
+    /* Array we are creating */
+    Data* array = NULL;
+
+    /* ================================ */
+
+
+
+    if ((list == NULL) || (count == NULL)) {
+        LIST_WARN(__func__, "provided list or count is NULL");
+
+        return NULL;
+    }
+
+    LIST_RDLOCK(list);
+
+    /* ================================================================ */
+    /* ============ Dynamically allocate memory for an array ========== */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((array = (Data*) malloc(((list->size > 0) ? list->size : 1) * sizeof(Data))) != NULL) {
+        *count = __List_to_array(list, array, list->size);
     }
     else {
-        warn_with_sys_msg(__func__);
+        LIST_WARN_SYS(__func__);
     }
 
-    /* ================================= */
+    LIST_UNLOCK(list);
 
-    return list;
+    /* ================================ */
+
+    return array;
 }
 
-/* ================================================================= */
+/* ================================================================ */
 
-void List_print(const List_t list, print_fptr print) {
+/**
+ * Implementation of List_copy_values that does not take the list lock.
+*/
+static size_t __List_copy_values(const List_t list, void* values, size_t size, size_t max) {
     /* =========== VARIABLES ========== */
 
-    /* Alternative print function */
-    print_fptr alt_print = NULL;
-
     /* Node we are using to traverse the list */
     Node_t node = NULL;
 
-    /* ================================= */
+    /* Node prefetched ahead of the traversal */
+    Node_t ahead = NULL;
+
+    /* Place of the next value */
+    unsigned char* value = (unsigned char*) values;
+
+    size_t count = 0;
+
+    /* ================================ */
+
 
 
-    
     /* ================================================================ */
     /* ================= Make sure a list is not NULL ================= */
     /* ================================================================ */
 
-    if (list != NULL) {
+    if (list == NULL) {
+        LIST_WARN("List_copy_values", "provided list is NULL");
 
-        /* ============= Make sure there is a function to use ============= */
-        if ((list->print == NULL) && (print == NULL)) {
-            warn_with_user_msg(__func__, "there is no associated `print` function with the given list");
+        return count;
+    }
 
-            return ;
+    if ((values == NULL) || (size == 0)) {
+        max = 0;
+    }
+
+    /* Boxed data is read, so it is prefetched too */
+    for (node = list->head, ahead = __List_prefetch_start(node); (node != NULL) && (count < max); node = node->next, ahead = __List_prefetch_step(ahead, 1), value += size) {
+
+        /* NULL data has no value, its place is zeroed */
+        if (node->data != NULL) {
+            memcpy(value, node->data, size);
+        }
+        else {
+            memset(value, 0, size);
         }
 
-        /* ================================= */
+        count++;
+    }
 
-        printf("[");
+    /* ================================ */
 
-        if (list->size > 0) {
+    return list->size;
+}
 
-            /* Use alternative print function if provided */
-            alt_print = (print != NULL) ? print : list->print;
+/* ================================================================ */
 
-            for (node = list->head; node != NULL; node = node->next) {
+size_t List_copy_values(const List_t list, void* values, size_t size, size_t max) {
+    /* =========== VARIABLES ========== */
 
-                /* Print the node data */
-                alt_print(node->data);
+    size_t count = 0;
 
-                if (node->next != NULL) {
-                    printf(", ");
-                }
-            }
-        }
+    /* ================================ */
 
-        printf("]\n");
-    }
-    else {
-        warn_with_user_msg(__func__, "provided list is NULL");
-    }
 
-    /* ================================= */
 
-    return ;
+    LIST_RDLOCK(list);
+
+    count = __List_copy_values(list, values, size, max);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return count;
 }
 
 /* ================================================================ */
 
-int List_insert_first(const List_t list, const Data data) {
+/**
+ * Implementation of List_index that does not take the list lock.
+*/
+static int __List_index(const List_t list, hash_fptr hash, size_t buckets) {
     /* =========== VARIABLES ========== */
 
-    /* Node we want to add */
-    Node_t node = NULL;
+    /* Index we are building */
+    Index_t index = NULL;
 
     int result = -1;
 
-    /* ================================= */
+    /* ================================ */
 
 
 
@@ -206,40 +3895,37 @@ int List_insert_first(const List_t list, const Data data) {
 
     if (list != NULL) {
 
-        /* ====================== Create a new node  ====================== */
-        if ((node = Node_create(data)) != NULL) {
+        /* ============= Make sure there is a function to use ============= */
+        if (list->match == NULL) {
+            LIST_WARN("List_index", "there is no associated `match` function with the given list");
 
-            switch (list->size) {
+            LIST_STAT_ADD(list, failures, 1);
 
-                /* If the list is empty */
-                case 0:
-                    list->head = list->tail = node;
+            return result;
+        }
 
-                    break ;
+        /* ================================= */
 
-                /* If there are nodes in the list */
-                default:
+        /* Size the table for the current content */
+        if ((index = Index_create(hash, (buckets > 0) ? buckets : list->size)) != NULL) {
 
-                    /* Connect a new node with the list head */
-                    node->next = list->head;
+            /* Drop the old index, the new one is built from scratch */
+            Index_destroy(&list->index);
 
-                    /* Set a new node to be the head of the list */
-                    list->head = node;
+            list->index = index;
 
-                    break ;
+            if (__List_index_nodes(list, list->head, NULL) == 0) {
+                result = 0;
+            }
+            else {
+                Index_destroy(&list->index);
             }
-
-            list->size++;
-
-            /* ================================= */
-
-            result = 0;
         }
 
-        /* Node_create function will tell you if there is an error occured while node creation */
+        /* Index_create function will tell you if there is an error occured while index creation */
     }
     else {
-        warn_with_user_msg(__func__, "provided list is NULL");
+        LIST_WARN("List_index", "provided list is NULL");
     }
 
     /* ================================ */
@@ -249,54 +3935,49 @@ int List_insert_first(const List_t list, const Data data) {
 
 /* ================================================================ */
 
-int List_insert_last(const List_t list, const Data data) {
+int List_index(const List_t list, hash_fptr hash, size_t buckets) {
     /* =========== VARIABLES ========== */
 
-    /* Node we want to add */
-    Node_t node = NULL;
-
     int result = -1;
 
-    /* ================================= */
+    /* ================================ */
 
 
 
-    /* ================================================================ */
-    /* ================= Make sure a list is not NULL ================= */
-    /* ================================================================ */
+    LIST_WRLOCK(list);
 
-    if (list != NULL) {
+    result = __List_index(list, hash, buckets);
 
-        /* ====================== Create a new node  ====================== */
-        if ((node = Node_create(data)) != NULL) {
+    LIST_UNLOCK(list);
 
-            /* If the list is empty */
-            switch (list->size) {
-                case 0:
-                    list->tail = list->head = node;
+    /* ================================ */
 
-                    break ;
+    return result;
+}
 
-                default:
+/* ================================================================ */
 
-                    list->tail->next = node;
+/**
+ * Implementation of List_unindex that does not take the list lock.
+*/
+static int __List_unindex(const List_t list) {
+    /* =========== VARIABLES ========== */
 
-                    list->tail = node;
+    int result = -1;
 
-                    break ;
-            }
+    /* ================================ */
 
-            list->size++;
 
-            /* ================================ */
-            
-            result = 0;
-        }
 
-        /* Node_create function will tell you if there is an error occured while node creation */
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+        result = Index_destroy(&list->index);
     }
     else {
-        warn_with_user_msg(__func__, "provided list is NULL");
+        LIST_WARN("List_unindex", "provided list is NULL");
     }
 
     /* ================================ */
@@ -306,66 +3987,39 @@ int List_insert_last(const List_t list, const Data data) {
 
 /* ================================================================ */
 
-Node_t List_find(const List_t list, const Data data, match_fptr match) {
+int List_unindex(const List_t list) {
     /* =========== VARIABLES ========== */
 
-    /* Alternative match function */
-    match_fptr alt_match = NULL;
-
-    /* Node we are using to traverse the list */
-    Node_t node = NULL;
-
-    /* ================================= */
-
-
-
-    /* ================================================================ */
-    /* ================= Make sure a list is not NULL ================= */
-    /* ================================================================ */
-
-    if (list != NULL) {
+    int result = -1;
 
-        if (data != NULL) {
+    /* ================================ */
 
-            /* ============= Make sure there is a function to use ============= */
-            if ((list->match == NULL) && (match == NULL)) {
-                warn_with_user_msg(__func__, "there is no associated `match` function with the given list");
 
-                return NULL;
-            }
 
-            /* ================================= */
+    LIST_WRLOCK(list);
 
-            /* Use alternative match function if provided */
-            alt_match = (match != NULL) ? match : list->match;
+    result = __List_unindex(list);
 
-            /* Traverse the list and compare its data */
-            for (node = list->head; (node != NULL) && (alt_match(node->data, data) != 0); node = node->next) ;
-        }
-    }
-    else {
-        warn_with_user_msg(__func__, "provided list is NULL");
-    }
+    LIST_UNLOCK(list);
 
     /* ================================ */
 
-    return node;
- }
+    return result;
+}
 
- /* ================================================================ */
+/* ================================================================ */
 
-int List_remove_first(const List_t list) {
+/**
+ * Implementation of List_skip that does not take the list lock.
+*/
+static int __List_skip(const List_t list, match_fptr order) {
     /* =========== VARIABLES ========== */
 
-    /* Node to be deleted */
-    Node_t node = NULL;
-
-    /* Data to be deleted */
-    Data data = NULL;
+    Skip_t skip = NULL;
 
     int result = -1;
 
-    /* ================================= */
+    /* ================================ */
 
 
 
@@ -375,36 +4029,27 @@ int List_remove_first(const List_t list) {
 
     if (list != NULL) {
 
-        /* If the list is not empty */
-        if (list->size > 0) {
-
-            node = list->head;
+        /* Skip_create function will tell you if there is an error occured while creation */
+        if ((skip = Skip_create((order != NULL) ? order : list->match)) != NULL) {
 
-            /* Set a new list head */
-            list->head = node->next;
+            if (Skip_build(skip, list->head) == 0) {
 
-            if (list->size == 1) {
-                list->tail = list->head = NULL;
-            }
+                /* Drop the old levels, the new ones are built from scratch */
+                Skip_destroy(&list->skip);
 
-            /* Update the list size */
-            list->size--;
+                list->skip = skip;
 
-            /* Destroy the node */
-            data = __Node_destroy(&node, __func__);
+                skip->changes = list->changes;
 
-            /* Destroy data if needed */
-            if (list->destroy != NULL) {
-                list->destroy(data);
+                result = 0;
+            }
+            else {
+                Skip_destroy(&skip);
             }
-
-            /* ================================ */
-
-            result = 0;
         }
     }
     else {
-        warn_with_user_msg(__func__, "provided list is NULL");
+        LIST_WARN("List_skip", "provided list is NULL");
     }
 
     /* ================================ */
@@ -414,68 +4059,68 @@ int List_remove_first(const List_t list) {
 
 /* ================================================================ */
 
-int List_remove_last(const List_t list) {
+int List_skip(const List_t list, match_fptr order) {
     /* =========== VARIABLES ========== */
 
-    /* Node to be deleted */
-    Node_t node = NULL;
+    int result = -1;
 
-    /* Node that is used to traverse the list */
-    Node_t temp = NULL;
+    /* ================================ */
 
-    /* Data to be deleted */
-    Data data = NULL;   
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_skip(list, order);
+
+    LIST_UNLOCK(list);
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+/**
+ * Implementation of List_unskip that does not take the list lock.
+*/
+static int __List_unskip(const List_t list) {
+    /* =========== VARIABLES ========== */
 
     int result = -1;
 
     /* ================================ */
 
-    
 
-    /* ================================================================ */
-    /* ================= Make sure a list is not NULL ================= */
-    /* ================================================================ */
 
     if (list != NULL) {
+        result = Skip_destroy(&list->skip);
+    }
+    else {
+        LIST_WARN("List_unskip", "provided list is NULL");
+    }
 
-        /* If the list is not empty */
-        if (list->size > 0) {
+    /* ================================ */
 
-            node = list->tail;
+    return result;
+}
 
-            /* Special case */
-            if (list->size == 1) {
-                list->tail = list->head = NULL;
-            }
-            /* Default case */
-            else {
-                
-                /* Traverse the list */
-                for (temp = list->head; temp->next != list->tail; temp = temp->next) ;
+/* ================================================================ */
 
-                /* Set a new list tail */
-                list->tail = temp;
+int List_unskip(const List_t list) {
+    /* =========== VARIABLES ========== */
 
-                temp->next = NULL;
-            }
+    int result = -1;
 
-            list->size--;
+    /* ================================ */
 
-            /* Destroy the node */
-            data =  __Node_destroy(&node, __func__);
 
-            if (list->destroy != NULL) {
-                list->destroy(data);
-            }
 
-            /* ================================ */
+    LIST_WRLOCK(list);
 
-            result = 0;
-        }
-    }
-    else {
-        warn_with_user_msg(__func__, "provided list is NULL");
-    }
+    result = __List_unskip(list);
+
+    LIST_UNLOCK(list);
 
     /* ================================ */
 
@@ -484,11 +4129,17 @@ int List_remove_last(const List_t list) {
 
 /* ================================================================ */
 
-int List_destroy(List_t* list) {
+/**
+ * Implementation of List_at that does not take the list lock.
+*/
+static Node_t __List_at(const List_t list, size_t index) {
     /* =========== VARIABLES ========== */
 
-    /* Operation result */
-    int result = -1;
+    /* Node we are using to traverse the list */
+    Node_t node = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
 
     /* ================================ */
 
@@ -498,94 +4149,90 @@ int List_destroy(List_t* list) {
     /* ================= Make sure a list is not NULL ================= */
     /* ================================================================ */
 
-    if ((list != NULL) && (*list != NULL)) {
+    if (list == NULL) {
+        LIST_WARN("List_at", "provided list is NULL");
 
-        /* Repeatedly delete elements */
-        while ((*list)->size > 0) {
-            List_remove_first(*list);
-        }
+        return NULL;
+    }
 
-        /* Clear memory */
-        memset(*list, 0, sizeof(struct _linked_list));
+    if (index >= list->size) {
+        LIST_WARN("List_at", "provided index is out of the list");
 
-        /* Deallocate memory */
-        free(*list);
+        LIST_STAT_ADD(list, failures, 1);
 
-        *list = NULL;
+        return NULL;
+    }
 
-        /* ================================ */
+    /* ================================ */
 
-        result = 0;
+    if ((list->skip != NULL) && !LIST_SKIP_STALE(list)) {
+        node = Skip_at(list->skip, list->head, index, &hops);
+    }
+    else {
+        for (node = list->head; index > 0; node = node->next, index--, hops++) ;
     }
 
-
+    LIST_STAT_ADD(list, hops, hops);
 
     /* ================================ */
 
-    return result;
+    return node;
 }
 
 /* ================================================================ */
 
-extern int List_merge(const List_t* dest, List_t* src) {
+Node_t List_at(const List_t list, size_t index) {
     /* =========== VARIABLES ========== */
 
-    int result = -1;
+    Node_t node = NULL;
 
     /* ================================ */
 
 
 
-    /* ================================================================ */
-    /* ================== Make sure dest is not NULL ================== */
-    /* ================================================================ */
-
-    if ((dest != NULL) && (*dest != NULL)) {
-
-        /* ================================================================ */
-        /* ================== Make sure src is not NULL =================== */
-        /* ================================================================ */
-
-        if ((src != NULL) && (*src != NULL)) {
-            
-            /* Add the src head to the tail of the dest list */
-            (*dest)->tail->next = (*src)->head;
-
-            /* Make the tail of the src list to be the tail of the dest list */
-            (*dest)->tail = (*src)->tail;
-
-            /* Compute a new size */
-            (*dest)->size += (*src)->size;
-
-            /* ================================ */
+    LIST_RDLOCK(list);
 
-            /* After the merge, the `src` list is eliminated */
-            memset(*src, 0, sizeof(struct _linked_list));
+    /* Stale skip list levels are rebuilt first, under the write lock */
+    if ((list != NULL) && LIST_SKIP_STALE(list)) {
+        LIST_UNLOCK(list);
 
-            List_destroy(src);
+        LIST_WRLOCK(list);
 
-            *src = NULL;
+        __List_skip_sync(list);
+    }
 
-            /* ================================ */
+    node = __List_at(list, index);
 
-            result = 0;
-        }
-    }
+    LIST_UNLOCK(list);
 
     /* ================================ */
 
-    return result;
+    return node;
 }
 
 /* ================================================================ */
 
-int List_remove_node(const List_t list, Node_t node) {
+/**
+ * Implementation of List_insert_sorted that does not take the list lock.
+*/
+static int __List_insert_sorted(const List_t list, const Data data, match_fptr order) {
     /* =========== VARIABLES ========== */
 
-    /* Node that is used to traverse the list */
-    Node_t temp = NULL;
+    /* Alternative order function */
+    match_fptr alt_order = NULL;
 
-    Data data = NULL;
+    /* Towers that precede the place of the new node */
+    struct _skip_path path;
+
+    /* Non-zero if the place is found through the skip list levels */
+    int skipped = 0;
+
+    /* The last node not ordered after data and the one after it */
+    Node_t prev = NULL;
+    Node_t node = NULL;
+
+    /* Nodes visited, for the list statistics */
+    size_t hops = 0;
 
     int result = -1;
 
@@ -594,77 +4241,115 @@ int List_remove_node(const List_t list, Node_t node) {
 
 
     /* ================================================================ */
-    /* ================= Make sure a node is not NULL ================= */
+    /* ================= Make sure a list is not NULL ================= */
     /* ================================================================ */
 
-    if (node == NULL) {
+    if (list == NULL) {
+        LIST_WARN("List_insert_sorted", "provided list is NULL");
+
+        return result;
+    }
+
+    /* Use alternative order function if provided, then the one of the skip list levels */
+    alt_order = (order != NULL) ? order : ((list->skip != NULL) ? list->skip->order : list->match);
+
+    /* ============= Make sure there is a function to use ============= */
+    if (alt_order == NULL) {
+        LIST_WARN("List_insert_sorted", "there is no associated `match` function with the given list");
+
+        LIST_STAT_ADD(list, failures, 1);
+
         return result;
     }
 
+    /* ================================ */
+
+    if ((list->skip != NULL) && (alt_order == list->skip->order)) {
+
+        __List_skip_sync(list);
+
+        skipped = !LIST_SKIP_STALE(list) && list->skip->sorted;
+    }
+
     /* ================================================================ */
-    /* ================= Make sure a list is not NULL ================= */
+    /* ============= Find the place, then link a new node ============= */
     /* ================================================================ */
 
-    if (list != NULL) {
+    if (skipped) {
+        prev = Skip_search(list->skip, list->head, data, 1, &path, &hops);
+    }
+    else {
+        for (node = list->head; (node != NULL) && (alt_order(node->data, data) <= 0); prev = node, node = node->next, hops++) ;
+    }
 
-        /* If the list is not empty */
-        if (list->size > 0) {
+    LIST_STAT_ADD(list, hops, hops);
 
-            /* Case 1. Remove the head */
-            if (node == list->head) {
-                List_remove_first(list); 
-            }
+    result = (prev != NULL) ? __List_insert_after(list, data, prev) : __List_insert_first(list, data, 0);
 
-            /* Case 2. Remove the tail */
-            else if (node == list->tail) {
-                List_remove_last(list);
-            }
+    /* The levels stay up to date, unless a tower cannot be raised */
+    if ((result == 0) && skipped && (Skip_link(list->skip, &path, (prev != NULL) ? prev->next : list->head) == 0)) {
+        list->skip->changes = list->changes;
+    }
 
-            /* Case 3. Somewhere in between head and tail */
-            else {
+    /* ================================ */
 
-                /* Make sure the specified node is in the list */
-                for (temp = list->head; temp != NULL && temp->next != node; temp = temp->next) ;
+    return result;
+}
 
-                /* The node IS in the list */
-                if (temp != NULL) {
+/* ================================================================ */
 
-                    temp->next = temp->next->next;
+int List_insert_sorted(const List_t list, const Data data, match_fptr order) {
+    /* =========== VARIABLES ========== */
 
-                    list->size--;
+    int result = -1;
 
-                    data = __Node_destroy(&node, __func__);
+    /* ================================ */
 
-                    if (list->destroy != NULL) {
-                        list->destroy(data);
-                    }
-                }
-            }
 
-            /* ================================ */
 
-            result = 0;
-        }
-    }
-    else {
-        warn_with_user_msg(__func__, "provided list is NULL");
-    }
+    LIST_WRLOCK(list);
+
+    result = __List_insert_sorted(list, data, order);
+
+    LIST_UNLOCK(list);
 
     /* ================================ */
-    
+
     return result;
 }
 
 /* ================================================================ */
 
-int List_insert_after(const List_t list, const Data data, const Node_t node) {
+/* ================================================================ */
+
+/**
+ * Implementation of List_sort that does not take the list lock.
+*/
+static int __List_sort(const List_t list, match_fptr match) {
     /* =========== VARIABLES ========== */
 
-    /* Node that is used to traverse the list */
-    Node_t temp = NULL;
+    /* Alternative match function */
+    match_fptr alt_match = NULL;
 
-    /* Node we are creating */
-    Node_t new_node = NULL;
+    /* Length of the runs merged in the current pass */
+    size_t run = 1;
+
+    /* Number of merges done in the current pass */
+    size_t merges = 0;
+
+    /* Heads of the left and right runs and their remaining lengths */
+    Node_t left = NULL;
+    Node_t right = NULL;
+
+    size_t left_size = 0;
+    size_t right_size = 0;
+
+    /* Node taken from one of the runs */
+    Node_t node = NULL;
+
+    /* Sorted chain being built in the current pass */
+    Node_t head = NULL;
+    Node_t tail = NULL;
 
     int result = -1;
 
@@ -673,120 +4358,184 @@ int List_insert_after(const List_t list, const Data data, const Node_t node) {
 
 
     /* ================================================================ */
-    /* ================== Make sure list is not NULL ================== */
+    /* ================= Make sure a list is not NULL ================= */
     /* ================================================================ */
 
     if (list != NULL) {
 
-        /* Special case. When there is no any node in the list */
-        if ((list->size == 0) || (node == NULL) || (node == list->tail)) {
-            result = List_insert_last(list, data);
+        /* ============= Make sure there is a function to use ============= */
+        if ((list->match == NULL) && (match == NULL)) {
+            LIST_WARN("List_sort", "there is no associated `match` function with the given list");
+
+            LIST_STAT_ADD(list, failures, 1);
+
+            return result;
         }
 
-        /* Default case  */
-        else {
+        /* ================================= */
 
-            /* ====================== Create a new node  ====================== */
-            if ((new_node = Node_create(data)) != NULL) {
+        /* Use alternative match function if provided */
+        alt_match = (match != NULL) ? match : list->match;
 
-                /* Make sure the specified node is in the list */
-                for (temp = list->head; temp != NULL && temp != node; temp = temp->next) ;
+        /* ================================================================ */
+        /* ====== Bottom-up merge: runs of 1, 2, 4, ... are relinked ====== */
+        /* ================================================================ */
 
-                /* The node IS in the list */
-                if (temp != NULL) {
+        for (run = 1; list->size > 1; run *= 2) {
 
-                    new_node->next = temp->next;
+            left = list->head;
 
-                    temp->next = new_node;
+            head = tail = NULL;
 
-                    list->size++;
+            merges = 0;
 
-                    /* ================================ */
+            while (left != NULL) {
 
-                    result = 0;
+                merges++;
+
+                /* The right run starts `run` nodes after the left one */
+                for (right = left, left_size = 0; (left_size < run) && (right != NULL); left_size++) {
+                    right = right->next;
                 }
-                /* If the list doesn't contain such a node */
-                else {
-                    __Node_destroy(&new_node, __func__);
 
-                    if (list->destroy != NULL) {
-                        list->destroy(data);
+                right_size = run;
+
+                /* Merge the two runs, taking from the left one on ties to stay stable */
+                while ((left_size > 0) || ((right_size > 0) && (right != NULL))) {
+
+                    if ((left_size == 0) || ((right_size > 0) && (right != NULL) && (alt_match(right->data, left->data) < 0))) {
+                        node = right;
+
+                        right = right->next;
+
+                        right_size--;
+                    }
+                    else {
+                        node = left;
+
+                        left = left->next;
+
+                        left_size--;
+                    }
+
+                    if (tail != NULL) {
+                        tail->next = node;
+                    }
+                    else {
+                        head = node;
                     }
+
+                    tail = node;
                 }
+
+                left = right;
+            }
+
+            tail->next = NULL;
+
+            list->head = head;
+
+            list->tail = tail;
+
+            /* A single merge means the whole list is one sorted run */
+            if (merges <= 1) {
+                break ;
             }
         }
+
+        list->changes++;
+
+        /* ================================ */
+
+        result = 0;
     }
     else {
-        warn_with_user_msg(__func__, "provided list is NULL");
+        LIST_WARN("List_sort", "provided list is NULL");
     }
 
+    /* ================================ */
+
     return result;
 }
 
 /* ================================================================ */
 
-int List_insert_before(const List_t list, const Data data, const Node_t node) {
+int List_sort(const List_t list, match_fptr match) {
     /* =========== VARIABLES ========== */
 
-    /* Node that is used to traverse the list */
-    Node_t temp = NULL;
+    int result = -1;
 
-    /* Node we are creating */
-    Node_t new_node = NULL;
+    /* ================================ */
 
-    int result = -1;
+
+
+    LIST_WRLOCK(list);
+
+    result = __List_sort(list, match);
+
+    LIST_UNLOCK(list);
 
     /* ================================ */
 
+    return result;
+}
 
+/* ================================================================ */
 
-    /* ================================================================ */
-    /* ================== Make sure list is not NULL ================== */
-    /* ================================================================ */
+void List_lock_read(const List_t list) {
+    LIST_RDLOCK(list);
+}
 
-    if (list != NULL) {
+/* ================================================================ */
 
-         /* Special case. When there is no any node in the list */
-        if ((list->size == 0) || (node == NULL) || (node == list->head)) {
-            result = List_insert_first(list, data);
-        }
-        else {
-            
-            /* ====================== Create a new node  ====================== */
-            if ((new_node = Node_create(data)) != NULL) {
+void List_lock_write(const List_t list) {
+    LIST_WRLOCK(list);
+}
 
-                /* Make sure the specified node is in the list */
-                for (temp = list->head; (temp != NULL) && (temp->next != node); temp = temp->next) ;
+/* ================================================================ */
 
-                /* The node IS in the list */
-                if (temp != NULL) {
+void List_unlock(const List_t list) {
+    LIST_UNLOCK(list);
+}
 
-                    new_node->next = temp->next;
+/* ================================================================ */
 
-                    temp->next = new_node;
+int List_stats(const List_t list, struct _list_stats* stats) {
+    /* =========== VARIABLES ========== */
 
-                    list->size++;
+    int result = -1;
 
-                    /* ================================ */
-                    
-                    result = 0;
-                }
-                /* Node is not in the list */
-                else {
-                    __Node_destroy(&new_node, __func__);
+    /* ================================ */
 
-                    if (list->destroy != NULL) {
-                        list->destroy(data);
-                    }
-                }
-            }
-        }
+
+
+#ifndef LIST_STATS
+    (void) list;
+
+    (void) stats;
+
+    LIST_WARN(__func__, "list statistics are kept only in LIST_STATS builds");
+#else
+    if ((list == NULL) || (stats == NULL)) {
+        LIST_WARN(__func__, "provided list or stats is NULL");
     }
     else {
-        warn_with_user_msg(__func__, "provided list is NULL");
+        LIST_RDLOCK(list);
+
+        *stats = list->stats;
+
+        /* Counted from the nodes held now, nodes may have been allocated by another list and moved here. Pooled nodes take a whole pool item */
+        stats->bytes = list->size * ((list->pool != NULL) ? list->pool->item_size : sizeof(struct _node));
+
+        LIST_UNLOCK(list);
+
+        result = 0;
     }
+#endif
 
     /* ================================ */
 
     return result;
-}
\ No newline at end of file
+}
+
+/* ================================================================ */
@@ -5,11 +5,68 @@
     extern "C" {
 #endif
 
+#include <pthread.h>
+
 #include "data/data.h"
+#include "pool/pool.h"
+#include "index/index.h"
+#include "skip/skip.h"
+#include "diagnostics/diagnostics.h"
 #include "../guard/guard.h"
 
 #define List_size(list) ((list != NULL) ? list->size : -1)
 
+/**
+ * Find the first node for which the condition holds, with the condition compiled inline.
+ * The condition refers to the current node through the `node` variable, e.g.
+ * `List_find_if(list, node, *((long*) node->data) == key);`
+ * 
+ * @param list list to search in (not NULL)
+ * @param node Node_t variable that receives the found node or NULL
+ * @param condition expression that is true for the node being searched
+*/
+#define List_find_if(list, node, condition) \
+    for ((node) = (list)->head; ((node) != NULL) && !(condition); (node) = (node)->next)
+
+/**
+ * Count nodes with the specified data.
+*/
+#define List_count(list, data, match) List_find_all((list), (data), (match), NULL, 0)
+
+/*
+ * Build options:
+ *  LIST_NO_SCRUB            - released nodes and lists are not zeroed before they are freed (all modules)
+ *  LIST_NO_DIAGNOSTICS      - failures are reported by return values only, no messages are printed (all modules)
+ *  LIST_DEBUG               - nodes and cursors passed by the caller are checked to belong to the list
+ *  LIST_PREFETCH_DISTANCE=n - traversals prefetch the node n positions ahead (default 4, 0 disables)
+ *  LIST_NO_PREFETCH_DATA    - traversals prefetch nodes but not the data they point to
+ *  LIST_INLINE_SIZE=n       - bytes of a value a node can hold itself (default 0, nodes hold data pointers only),
+ *                             an integer literal the same for every object linked together
+ *  LIST_STATS               - lists count node allocations, traversal hops and failures, see List_stats
+*/
+
+/* Values up to this many bytes can be stored in a node, see List_insert_first_value. Every node grows by this much */
+#ifndef LIST_INLINE_SIZE
+    #define LIST_INLINE_SIZE 0
+#endif
+
+/*
+ * Objects built with different LIST_INLINE_SIZE lay nodes out differently and must not be linked together.
+ * Every object that includes this header refers to a symbol named after its size (List_layout_inline_<n>),
+ * list.c defines only the one of its own build, so a mismatch fails to link.
+*/
+#define LIST_LAYOUT_SYMBOL(size) LIST_LAYOUT_SYMBOL_(size)
+#define LIST_LAYOUT_SYMBOL_(size) List_layout_inline_ ## size
+
+extern const int LIST_LAYOUT_SYMBOL(LIST_INLINE_SIZE);
+
+static const int* const List_layout_check __attribute__((used, unused)) = &LIST_LAYOUT_SYMBOL(LIST_INLINE_SIZE);
+
+/* Traversals prefetch the node this many positions ahead of the visited one, 0 disables prefetching */
+#ifndef LIST_PREFETCH_DISTANCE
+    #define LIST_PREFETCH_DISTANCE 4
+#endif
+
 /* ================================================================ */
 /* ======================= TYPES DEFINITIONS ====================== */
 /* ================================================================ */
@@ -28,6 +85,20 @@ typedef struct _linked_list* List_t;
 
 /* ================================ */
 
+/**
+ * A position in a linked list that remembers the preceding node, so edits at it take constant time
+*/
+typedef struct _list_cursor* Cursor_t;
+
+/* ================================ */
+
+/**
+ * A read-only position in a linked list that hands out data rather than nodes
+*/
+typedef struct _list_iterator* Iterator_t;
+
+/* ================================ */
+
 /* ================================================================ */
 /* ====================== TYPES IMPLEMENTAION ===================== */
 /* ================================================================ */
@@ -38,6 +109,31 @@ struct _node {
 
     /* The next node in the sequence */
     struct _node* next;
+
+#if LIST_INLINE_SIZE > 0
+    /* Small value stored in the node itself, `data` points here then (pointer-aligned, it follows two pointers) */
+    unsigned char value[LIST_INLINE_SIZE];
+#endif
+};
+
+struct _list_stats {
+    /* Nodes allocated by the list, nodes moved in from other lists are not counted */
+    size_t allocated;
+
+    /* Nodes released by the list, nodes moved out to other lists are not counted */
+    size_t freed;
+
+    /* Bytes taken by the nodes the list holds now, filled in by List_stats */
+    size_t bytes;
+
+    /* Largest number of elements the list has held */
+    size_t peak_size;
+
+    /* Nodes (and skip list towers) visited by searches, positional lookups and by removals and insertions that look for their place */
+    size_t hops;
+
+    /* Operations that failed on a valid list, e.g. a node not in the list or a missing match function */
+    size_t failures;
 };
 
 struct _linked_list {
@@ -50,6 +146,27 @@ struct _linked_list {
     /* Last element of the list */
     struct _node* tail;
 
+    /* Pool the nodes are taken from, NULL if nodes are allocated one by one */
+    Pool_t pool;
+
+    /* Hash index of nodes by their data, NULL if the list is not indexed */
+    Index_t index;
+
+    /* Skip list levels over the nodes, NULL if the list has none. Rebuilt when `changes` shows they are stale */
+    Skip_t skip;
+
+    /* Reader-writer lock taken by List_* functions, NULL unless created with List_create_concurrent */
+    pthread_rwlock_t* lock;
+
+    /* Incremented by every change of the node sequence, so cached views of it can tell they are stale */
+    size_t changes;
+
+    /* Segment starts cached by parallel traversals (see parallel/parallel.h), NULL until first needed */
+    struct _list_segments* segments;
+
+    /* Memory and traversal counters, updated only in LIST_STATS builds */
+    struct _list_stats stats;
+
     /* ================================================================ */
     /* ==== Members not used by linked lists but by datatypes that ==== */
     /* =========== will derive them later from linked lists =========== */
@@ -65,6 +182,22 @@ struct _linked_list {
     match_fptr match;
 };
 
+struct _list_cursor {
+    /* List the cursor walks through */
+    struct _linked_list* list;
+
+    /* Node that precedes the current one, NULL if the current node is the head */
+    struct _node* prev;
+
+    /* Current node, NULL if the cursor is past the end of the list */
+    struct _node* node;
+};
+
+struct _list_iterator {
+    /* Internal state, only List_iter_* functions may use it. Node whose data is handed out next */
+    struct _node* node;
+};
+
 /* ================================================================ */
 /* ========================== List_t API ========================== */
 /* ================================================================ */
@@ -92,6 +225,39 @@ extern List_t List_create(destroy_fptr destroy, print_fptr print, match_fptr mat
 
 /* ================================================================ */
 
+/**
+ * Allocate a new instance of a linked list data type whose nodes are taken from a pool.
+ * Pools take no lock, so lists sharing a pool must not be used by several threads at once.
+ * 
+ * @param destroy pointer to a function that handles the deletion of a linked list node
+ * @param print pointer to a function that prints data residing in a linked list node
+ * @param match a pointer to a function that compares data in a linked list node
+ * @param pool pool to share with other lists (items of at least sizeof(struct _node) bytes), or NULL to create a private one
+ * 
+ * @return a new instance of a linked list on success, NULL on failure.
+*/
+extern List_t List_create_pooled(destroy_fptr destroy, print_fptr print, match_fptr match, const Pool_t pool);
+
+/* ================================================================ */
+
+/**
+ * Allocate a new instance of a linked list data type that can be shared between threads.
+ * Every List_* function takes the list lock: lookups and prints share it, changes take it exclusively.
+ * Nodes returned by lookups and cursors are only safe to use while the caller holds the lock
+ * (see List_lock_read/List_lock_write), and locked List_* functions must not be called meanwhile.
+ * Nodes are allocated one by one: the list lock does not cover a pool, so concurrent lists never take
+ * nodes from one (see List_create_pooled).
+ * 
+ * @param destroy pointer to a function that handles the deletion of a linked list node
+ * @param print pointer to a function that prints data residing in a linked list node
+ * @param match a pointer to a function that compares data in a linked list node
+ * 
+ * @return a new instance of a linked list on success, NULL on failure.
+*/
+extern List_t List_create_concurrent(destroy_fptr destroy, print_fptr print, match_fptr match);
+
+/* ================================================================ */
+
 /**
  * Output the content of a linked list.
  * 
@@ -128,8 +294,97 @@ extern int List_insert_last(const List_t list, const Data data);
 
 /* ================================================================ */
 
+/**
+ * Insert a copy of a small value at the beginning of the list. The value is stored in the node itself,
+ * so it takes no allocation of its own and node->data points to the copy. The destroy function of the
+ * list is never called on such values. Needs a build with LIST_INLINE_SIZE > 0.
+ * 
+ * @param list list to insert into
+ * @param value value to be copied
+ * @param size size of the value, at most LIST_INLINE_SIZE bytes
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_insert_first_value(const List_t list, const void* value, size_t size);
+
+/* ================================================================ */
+
+/**
+ * Insert a copy of a small value at the end of the list, see List_insert_first_value.
+ * 
+ * @param list list to insert into
+ * @param value value to be copied
+ * @param size size of the value, at most LIST_INLINE_SIZE bytes
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_insert_last_value(const List_t list, const void* value, size_t size);
+
+/* ================================================================ */
+
+/**
+ * Insert an array of data at the beginning of the linked list, keeping the array order
+ * (data[0] becomes the new head). Nodes are created and linked in one pass.
+ * 
+ * @param list list to insert into
+ * @param data array of data to be inserted
+ * @param n number of elements in the array
+ * 
+ * @return 0 on success, negative value on error (the list is left unchanged).
+*/
+extern int List_insert_first_n(const List_t list, const Data* data, size_t n);
+
+/* ================================================================ */
+
+/**
+ * Insert an array of data at the end of the linked list, keeping the array order.
+ * Nodes are created and linked in one pass, nodes of a pooled list come from one chunk.
+ * 
+ * @param list list to insert into
+ * @param data array of data to be inserted
+ * @param n number of elements in the array
+ * 
+ * @return 0 on success, negative value on error (the list is left unchanged).
+*/
+extern int List_insert_last_n(const List_t list, const Data* data, size_t n);
+
+/* ================================================================ */
+
+/**
+ * Build a new linked list out of an array of data. All nodes are allocated in one block.
+ * 
+ * @param destroy pointer to a function that handles the deletion of a linked list node
+ * @param print pointer to a function that prints data residing in a linked list node
+ * @param match a pointer to a function that compares data in a linked list node
+ * @param data array of data to be inserted
+ * @param n number of elements in the array
+ * 
+ * @return a new instance of a linked list on success, NULL on failure.
+*/
+extern List_t List_from_array(destroy_fptr destroy, print_fptr print, match_fptr match, const Data* data, size_t n);
+
+/* ================================================================ */
+
+/**
+ * Build a new linked list out of an array of small values, copied into the nodes (see List_insert_last_value).
+ * All nodes are allocated in one block. This reverses List_copy_values.
+ * 
+ * @param destroy pointer to a function that handles the deletion of a linked list node
+ * @param print pointer to a function that prints data residing in a linked list node
+ * @param match a pointer to a function that compares data in a linked list node
+ * @param values array of values to be copied
+ * @param size size of every value, at most LIST_INLINE_SIZE bytes
+ * @param n number of values in the array
+ * 
+ * @return a new instance of a linked list on success, NULL on failure.
+*/
+extern List_t List_from_values(destroy_fptr destroy, print_fptr print, match_fptr match, const void* values, size_t size, size_t n);
+
+/* ================================================================ */
+
 /**
  * Find a node in the list with specified data (the first occurrence).
+ * Lists with skip list levels sorted by the match function are searched in O(log n), see List_skip.
  * 
  * @param list list to search in
  * @param data data to be searched
@@ -141,6 +396,47 @@ extern Node_t List_find(const List_t list, const Data data, match_fptr match);
 
 /* ================================================================ */
 
+/**
+ * Find a node whose data is an int equal to the key (the first occurrence), comparing inline.
+ * Nodes with NULL data are skipped.
+ * 
+ * @param list list of int data to search in
+ * @param key key to be searched
+ * 
+ * @return node with the specified key on success, NULL on failure.
+*/
+extern Node_t List_find_int(const List_t list, int key);
+
+/* ================================================================ */
+
+/**
+ * Find a node whose data is a C string equal to the key (the first occurrence), comparing inline.
+ * Nodes with NULL data are skipped.
+ * 
+ * @param list list of C string data to search in
+ * @param key key to be searched
+ * 
+ * @return node with the specified key on success, NULL on failure.
+*/
+extern Node_t List_find_str(const List_t list, const char* key);
+
+/* ================================================================ */
+
+/**
+ * Find all nodes in the list with specified data.
+ * 
+ * @param list list to search in
+ * @param data data to be searched
+ * @param match alternative match function used to compare data in a linked list node
+ * @param nodes array that receives matching nodes in list order, may be NULL
+ * @param max capacity of the nodes array
+ * 
+ * @return total number of matching nodes (may be greater than max).
+*/
+extern size_t List_find_all(const List_t list, const Data data, match_fptr match, Node_t* nodes, size_t max);
+
+/* ================================================================ */
+
 /**
  * Remove the first element from the list
  * 
@@ -174,6 +470,17 @@ extern int List_destroy(List_t* list);
 
 /* ================================================================ */
 
+/**
+ * Remove all elements from the list, keeping the list itself.
+ * 
+ * @param list list to be cleared
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_clear(const List_t list);
+
+/* ================================================================ */
+
 /**
  * Merge two lists into one.
  * 
@@ -186,6 +493,97 @@ extern int List_merge(const List_t* dest, List_t* src);
 
 /* ================================================================ */
 
+/**
+ * Merge a sorted list into another one so the result stays sorted, relinking nodes in a single pass.
+ * Equal data of dest goes first. As with List_merge, nodes are relinked if both lists take them from the
+ * same place (no pool or the same one), otherwise data is first copied into new nodes of dest.
+ * 
+ * @param dest the destination list, sorted by the order function
+ * @param src the source list sorted by the order function, eliminated after the merge
+ * @param order function that orders data, the dest match function if NULL
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_merge_sorted(const List_t* dest, List_t* src, match_fptr order);
+
+/* ================================================================ */
+
+/**
+ * Merge n sorted lists into another one so the result stays sorted, relinking nodes in a single pass
+ * that takes O(log n) comparisons per node. Equal data goes in the order of the lists, dest first.
+ * Data of lists that take nodes from another place than dest is first copied into new nodes of dest.
+ * 
+ * @param dest the destination list, sorted by the order function
+ * @param src array of n source lists sorted by the order function, all eliminated after the merge
+ * @param n number of source lists
+ * @param order function that orders data, the dest match function if NULL
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_merge_sorted_n(const List_t* dest, List_t* src, size_t n, match_fptr order);
+
+/* ================================================================ */
+
+/**
+ * Move all nodes of a list to the end of another one, leaving the source list empty but alive.
+ * Nodes are relinked if both lists take them from the same place, otherwise data is moved into new nodes.
+ * 
+ * @param dest the destination list
+ * @param src the source list, left empty
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_merge_keep(const List_t dest, const List_t src);
+
+/* ================================================================ */
+
+/**
+ * List_merge_sorted that leaves the source list empty but alive.
+ * 
+ * @param dest the destination list, sorted by the order function
+ * @param src the source list sorted by the order function, left empty
+ * @param order function that orders data, the dest match function if NULL
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_merge_sorted_keep(const List_t dest, const List_t src, match_fptr order);
+
+/* ================================================================ */
+
+/**
+ * Split the list after the node, moving the nodes that follow it into a new list of the same kind
+ * (same functions, pool and locking). No node is copied, but the moved nodes are counted and move from
+ * the list index to the index of the new list, so the split takes O(k) for k moved nodes.
+ * The new list is indexed by the same hash function and has skip list levels with the same order
+ * (built on first use) if the list has them.
+ * The node must be in the list, it is checked only in LIST_DEBUG builds.
+ * 
+ * @param list list to be split
+ * @param node the node that becomes the tail of the list, NULL to move all nodes
+ * 
+ * @return the list of the nodes that followed the node on success, NULL on failure.
+*/
+extern List_t List_split_at(const List_t list, const Node_t node);
+
+/* ================================================================ */
+
+/**
+ * Move a range of nodes from one list into another by relinking them. Both lists must take nodes from
+ * the same place (no pool or the same one). The nodes given must be in their lists, it is checked only in
+ * LIST_DEBUG builds; the range is always checked to end with the last node.
+ * 
+ * @param dest the destination list
+ * @param after node of dest the range is linked after, NULL to link it before the head
+ * @param src the source list
+ * @param prev node of src that precedes the range, NULL if the range starts at the head
+ * @param last the last node of the range, NULL for the tail of src
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_splice(const List_t dest, const Node_t after, const List_t src, const Node_t prev, const Node_t last);
+
+/* ================================================================ */
+
 /**
  * Remove the specified node from the list
  * 
@@ -200,6 +598,7 @@ extern int List_remove_node(const List_t list, Node_t node);
 
 /**
  * Insert a new node with specified data after the node.
+ * The node must be in the list, it is checked only in LIST_DEBUG builds.
  * 
  * @param list list to insert into
  * @param data data to be inserted
@@ -224,6 +623,289 @@ extern int List_insert_before(const List_t list, const Data data, const Node_t n
 
 /* ================================================================ */
 
+/**
+ * Sort the list in place with a stable bottom-up merge sort, relinking nodes without allocating memory.
+ * 
+ * @param list list to be sorted
+ * @param match alternative match function used to order data (negative, zero, positive like strcmp)
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_sort(const List_t list, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Attach a hash index to the list, so List_find with the list match function takes expected O(1).
+ * The index is kept up to date by every function that inserts or removes nodes.
+ * Data must not change in a way that changes its hash while it is in the list.
+ * Equal data is not chained under one key: lookups and removals of data with d equal elements take O(d),
+ * and with more than LIST_INDEX_CANDIDATES (8) of them List_find scans the list from its head to find the
+ * first one. Lists with many equal elements gain little from an index.
+ * 
+ * @param list list to be indexed (must have a match function)
+ * @param hash pointer to a function that computes a hash of data, consistent with the match function
+ * @param buckets initial number of buckets, the list size if 0
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_index(const List_t list, hash_fptr hash, size_t buckets);
+
+/* ================================================================ */
+
+/**
+ * Detach and destroy the hash index of the list.
+ * 
+ * @param list list to be unindexed
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_unindex(const List_t list);
+
+/* ================================================================ */
+
+/**
+ * Attach skip list levels to the list. They give O(log n) List_at, and while the list is sorted by the
+ * order function, O(log n) List_find and List_insert_sorted with it. The order of nodes is not changed.
+ * List_insert_sorted keeps the levels up to date, other changes make them stale and they are rebuilt
+ * with a single walk the next time they are needed.
+ * 
+ * @param list list to be given skip list levels
+ * @param order function that orders data (negative, 0, positive), the list match function if NULL
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_skip(const List_t list, match_fptr order);
+
+/* ================================================================ */
+
+/**
+ * Detach and destroy the skip list levels of the list.
+ * 
+ * @param list list to be stripped of skip list levels
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_unskip(const List_t list);
+
+/* ================================================================ */
+
+/**
+ * Get the node at the position, O(log n) on lists with skip list levels and O(n) otherwise.
+ * 
+ * @param list list to search in
+ * @param index position of the node, 0 for the head
+ * 
+ * @return node at the position on success, NULL on failure.
+*/
+extern Node_t List_at(const List_t list, size_t index);
+
+/* ================================================================ */
+
+/**
+ * Insert data into a sorted list after all nodes not ordered after it, so the list stays sorted.
+ * 
+ * @param list list sorted by the order function
+ * @param data data to be inserted
+ * @param order function that orders data, the one of the skip list levels or the list match function if NULL
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_insert_sorted(const List_t list, const Data data, match_fptr order);
+
+/* ================================================================ */
+
+/**
+ * Place the cursor on the head of the list. The cursor is usually a local variable:
+ * `struct _list_cursor cursor; List_cursor_init(&cursor, list);`
+ * Changing the list other than through the cursor invalidates it.
+ * 
+ * @param cursor cursor to be initialized
+ * @param list list to walk through
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_cursor_init(const Cursor_t cursor, const List_t list);
+
+/* ================================================================ */
+
+/**
+ * Move the cursor to the next node.
+ * 
+ * @param cursor cursor to be moved
+ * 
+ * @return the new current node, NULL if the cursor is past the end of the list.
+*/
+extern Node_t List_cursor_next(const Cursor_t cursor);
+
+/* ================================================================ */
+
+/**
+ * Remove the current node in constant time. The cursor moves on to the node that followed it.
+ * 
+ * @param cursor cursor standing on the node to be removed
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_cursor_remove(const Cursor_t cursor);
+
+/* ================================================================ */
+
+/**
+ * Insert a new node with specified data before the current node in constant time.
+ * The cursor stays on the same node. Past the end of the list the node is appended.
+ * 
+ * @param cursor cursor that points at the insertion place
+ * @param data data to be inserted
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_cursor_insert_before(const Cursor_t cursor, const Data data);
+
+/* ================================================================ */
+
+/**
+ * Insert a new node with specified data after the current node in constant time.
+ * The cursor stays on the same node. Past the end of the list the node is appended.
+ * 
+ * @param cursor cursor that points at the insertion place
+ * @param data data to be inserted
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_cursor_insert_after(const Cursor_t cursor, const Data data);
+
+/* ================================================================ */
+
+/**
+ * Place the iterator before the first element of the list. The iterator is usually a local variable:
+ * `struct _list_iterator iter; Data data; List_iter_init(&iter, list); while (List_iter_next(&iter, &data) == 0) ...`
+ * Changing the list invalidates the iterator; concurrent lists must stay locked while it is used.
+ * 
+ * @param iter iterator to be initialized
+ * @param list list to walk through
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_iter_init(const Iterator_t iter, const List_t list);
+
+/* ================================================================ */
+
+/**
+ * Hand out the data of the next element.
+ * 
+ * @param iter iterator to be moved
+ * @param data where to store the data
+ * 
+ * @return 0 on success, negative value at the end of the list or on failure.
+*/
+extern int List_iter_next(const Iterator_t iter, Data* data);
+
+/* ================================================================ */
+
+/**
+ * Call a function on the data of every element, in list order. The function must not change the list.
+ * 
+ * @param list list to walk through
+ * @param visit function called on every data
+ * @param arg argument passed to every call
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_for_each(const List_t list, visit_fptr visit, void* arg);
+
+/* ================================================================ */
+
+/**
+ * Copy the data pointers of the list into an array in list order, in a single pass.
+ * 
+ * @param list list to be copied
+ * @param array array that receives the first `max` data pointers, may be NULL
+ * @param max capacity of the array
+ * 
+ * @return number of elements in the list (may be greater than max).
+*/
+extern size_t List_to_array(const List_t list, Data* array, size_t max);
+
+/* ================================================================ */
+
+/**
+ * Copy the data pointers of the list into a new array in list order, in a single pass.
+ * YOU NEED TO CALL free ON THE RETURNED ARRAY.
+ * 
+ * @param list list to be copied
+ * @param count number of elements in the array on success
+ * 
+ * @return a new array on success, NULL on failure.
+*/
+extern Data* List_to_array_alloc(const List_t list, size_t* count);
+
+/* ================================================================ */
+
+/**
+ * Copy the values data points to into a contiguous array in list order, in a single pass, e.g.
+ * `int keys[n]; List_copy_values(list, keys, sizeof(int), n);`
+ * Works both for values stored in the nodes and for boxed data of at least `size` bytes.
+ * Nodes with NULL data give values of zero bytes.
+ * 
+ * @param list list to be copied
+ * @param values array that receives the first `max` values, may be NULL
+ * @param size size of every value, at most LIST_INLINE_SIZE bytes for values stored in the nodes
+ * @param max capacity of the array, in values
+ * 
+ * @return number of elements in the list (may be greater than max).
+*/
+extern size_t List_copy_values(const List_t list, void* values, size_t size, size_t max);
+
+/* ================================================================ */
+
+/**
+ * Take the lock of a concurrent list for reading, so several lookups or a cursor walk see the same list.
+ * Does nothing for lists not created with List_create_concurrent.
+ * 
+ * @param list list to be locked
+ * 
+ * @return none.
+*/
+extern void List_lock_read(const List_t list);
+
+/* ================================================================ */
+
+/**
+ * Take the lock of a concurrent list exclusively, e.g. for edits through a cursor.
+ * Does nothing for lists not created with List_create_concurrent.
+ * 
+ * @param list list to be locked
+ * 
+ * @return none.
+*/
+extern void List_lock_write(const List_t list);
+
+/* ================================================================ */
+
+/**
+ * Release the lock taken with List_lock_read or List_lock_write.
+ * 
+ * @param list list to be unlocked
+ * 
+ * @return none.
+*/
+extern void List_unlock(const List_t list);
+
+/* ================================================================ */
+
+/**
+ * Copy the counters of a list. The counters are kept only in LIST_STATS builds.
+ * 
+ * @param list list to be inspected
+ * @param stats structure that receives the counters
+ * 
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_stats(const List_t list, struct _list_stats* stats);
+
+/* ================================================================ */
+
 #ifdef __cplusplus
     }
 #endif
@@ -0,0 +1,693 @@
+#include "parallel.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/* Threads looking for the first match check whether a preceding segment has found one every this many nodes */
+#define PARALLEL_CHECK_EVERY 256
+
+/* ================================================================ */
+/* ============================= TYPES ============================ */
+/* ================================================================ */
+
+/* Operations a segment can be processed with */
+enum _parallel_op {
+    PARALLEL_FIND,
+    PARALLEL_FIND_ALL,
+    PARALLEL_FOR_EACH,
+    PARALLEL_REDUCE
+};
+
+/* ================================ */
+
+/* What every thread of a call does, shared by all segments */
+struct _parallel_job {
+    enum _parallel_op op;
+
+    /* Data to be searched and the function to compare it with */
+    Data data;
+
+    match_fptr match;
+
+    /* Function called on every data and its argument */
+    visit_fptr visit;
+
+    void* arg;
+
+    /* Function that folds data into an accumulator */
+    reduce_fptr reduce;
+
+    /* Lowest segment that has found a match so far, SIZE_MAX if none */
+    atomic_size_t found;
+};
+
+/* ================================ */
+
+/* A segment of the list processed by a single thread */
+struct _parallel_task {
+    struct _parallel_job* job;
+
+    /* Position of the segment in the list */
+    size_t segment;
+
+    /* First node of the segment */
+    Node_t first;
+
+    /* Node that follows the segment, NULL for the last one */
+    Node_t stop;
+
+    /* Number of nodes in the segment */
+    size_t length;
+
+    /* The first matching node of the segment */
+    Node_t node;
+
+    /* Number of matching nodes in the segment */
+    size_t count;
+
+    /* Matching nodes stored so far and how many fit */
+    Node_t* nodes;
+
+    size_t max;
+
+    /* Accumulator of the segment */
+    void* acc;
+};
+
+/* ================================================================ */
+/* ============================ STATIC ============================ */
+/* ================================================================ */
+
+/**
+ * Process a single segment.
+ *
+ * @param arg task of the segment
+ *
+ * @return none (NULL).
+*/
+static void* __Parallel_worker(void* arg) {
+    /* =========== VARIABLES ========== */
+
+    struct _parallel_task* task = (struct _parallel_task*) arg;
+
+    struct _parallel_job* job = task->job;
+
+    /* Node we are using to traverse the segment */
+    Node_t node = NULL;
+
+    /* Lowest segment with a match */
+    size_t found = 0;
+
+    size_t i = 0;
+
+    /* ================================= */
+
+
+
+    switch (job->op) {
+
+        case PARALLEL_FIND:
+
+            for (node = task->first; node != task->stop; node = node->next, i++) {
+
+                /* Nothing found here can precede a match in an earlier segment */
+                if ((i % PARALLEL_CHECK_EVERY == 0) && (atomic_load(&job->found) < task->segment)) {
+                    break ;
+                }
+
+                if (job->match(node->data, job->data) == 0) {
+
+                    task->node = node;
+
+                    /* Keep the lowest segment */
+                    for (found = atomic_load(&job->found); (task->segment < found) && !atomic_compare_exchange_weak(&job->found, &found, task->segment); ) ;
+
+                    break ;
+                }
+            }
+
+            break ;
+
+        case PARALLEL_FIND_ALL:
+
+            for (node = task->first; node != task->stop; node = node->next) {
+
+                if (job->match(node->data, job->data) == 0) {
+
+                    /* Store as many nodes as fit, but count all of them */
+                    if (task->count < task->max) {
+                        task->nodes[task->count] = node;
+                    }
+
+                    task->count++;
+                }
+            }
+
+            break ;
+
+        case PARALLEL_FOR_EACH:
+
+            for (node = task->first; node != task->stop; node = node->next) {
+                job->visit(node->data, job->arg);
+            }
+
+            break ;
+
+        case PARALLEL_REDUCE:
+
+            for (node = task->first; node != task->stop; node = node->next) {
+                job->reduce(task->acc, node->data);
+            }
+
+            break ;
+    }
+
+    /* ================================= */
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+/**
+ * Record the first node of every segment with a single walk over the list.
+ *
+ * @param list list to be split
+ * @param segments segments to fill in
+ *
+ * @return none.
+*/
+static void __Parallel_record(const List_t list, struct _list_segments* segments) {
+    /* =========== VARIABLES ========== */
+
+    /* Node we are using to traverse the list */
+    Node_t node = list->head;
+
+    /* Nodes left to be assigned to a segment */
+    size_t length = 0;
+
+    /* ================================= */
+
+
+
+    segments->count = list->size / PARALLEL_MIN_SEGMENT;
+
+    if (segments->count > PARALLEL_MAX_THREADS) {
+        segments->count = PARALLEL_MAX_THREADS;
+    }
+
+    for (size_t i = 0; i < segments->count; i++) {
+
+        segments->first[i] = node;
+
+        /* Spread the remainder over the first segments */
+        for (length = list->size / segments->count + ((i < list->size % segments->count) ? 1 : 0); length > 0; length--) {
+            node = node->next;
+        }
+    }
+
+    segments->first[segments->count] = NULL;
+
+    segments->changes = list->changes;
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+/**
+ * Get the segments of the list, recording them again if the list has changed since the last time.
+ * The caller holds the read lock; it is traded for the write lock while the segments are recorded.
+ *
+ * @param list list to be split
+ *
+ * @return up-to-date segments on success, NULL on failure.
+*/
+static struct _list_segments* __Parallel_segments(const List_t list) {
+
+    while ((list->segments == NULL) || (list->segments->changes != list->changes)) {
+
+        List_unlock(list);
+
+        List_lock_write(list);
+
+        /* Somebody else may have recorded them in between */
+        if (list->segments == NULL) {
+
+            /* Fresh segments hold nothing yet, so they are always recorded */
+            if ((list->segments = (struct _list_segments*) malloc(sizeof(struct _list_segments))) == NULL) {
+                LIST_WARN_SYS(__func__);
+            }
+            else {
+                __Parallel_record(list, list->segments);
+            }
+        }
+        else if (list->segments->changes != list->changes) {
+            __Parallel_record(list, list->segments);
+        }
+
+        List_unlock(list);
+
+        List_lock_read(list);
+
+        if (list->segments == NULL) {
+            return NULL;
+        }
+    }
+
+    /* ================================= */
+
+    return list->segments;
+}
+
+/* ================================================================ */
+
+/**
+ * Assign runs of consecutive segments to threads.
+ *
+ * @param list list to be split (locked for reading by the caller)
+ * @param job job shared by the segments
+ * @param tasks array of PARALLEL_MAX_THREADS tasks to fill in
+ * @param threads requested number of threads, 0 for the number of online CPUs
+ *
+ * @return number of tasks.
+*/
+static size_t __Parallel_split(const List_t list, struct _parallel_job* job, struct _parallel_task* tasks, size_t threads) {
+    /* =========== VARIABLES ========== */
+
+    struct _list_segments* segments = NULL;
+
+    /* Number of tasks */
+    size_t count = threads;
+
+    /* ================================= */
+
+
+
+    if (count == 0) {
+        count = (sysconf(_SC_NPROCESSORS_ONLN) > 0) ? (size_t) sysconf(_SC_NPROCESSORS_ONLN) : 1;
+    }
+
+    /* Threads are not worth starting for short lists */
+    if ((count > 1) && (list->size >= 2 * PARALLEL_MIN_SEGMENT) && ((segments = __Parallel_segments(list)) != NULL) && (segments->count > 1)) {
+
+        if (count > segments->count) {
+            count = segments->count;
+        }
+    }
+    else {
+        count = 1;
+
+        segments = NULL;
+    }
+
+    /* ================================================================ */
+    /* ============= Every task takes a run of segments =============== */
+    /* ================================================================ */
+
+    memset(tasks, 0, count * sizeof(struct _parallel_task));
+
+    for (size_t i = 0; i < count; i++) {
+
+        tasks[i].job = job;
+
+        tasks[i].segment = i;
+
+        tasks[i].first = (segments != NULL) ? segments->first[i * segments->count / count] : list->head;
+
+        tasks[i].stop = (segments != NULL) ? segments->first[(i + 1) * segments->count / count] : NULL;
+
+        if (segments == NULL) {
+            tasks[i].length = list->size;
+
+            continue ;
+        }
+
+        /* Lengths of the recorded segments, the remainder is spread as by __Parallel_record */
+        for (size_t j = i * segments->count / count; j < (i + 1) * segments->count / count; j++) {
+            tasks[i].length += list->size / segments->count + ((j < list->size % segments->count) ? 1 : 0);
+        }
+    }
+
+    /* ================================= */
+
+    return count;
+}
+
+/* ================================================================ */
+
+/**
+ * Process all segments and wait for them. The calling thread processes the first segment itself,
+ * as well as any segment a thread could not be started for.
+ *
+ * @param tasks tasks of the segments
+ * @param count number of segments
+ *
+ * @return none.
+*/
+static void __Parallel_run(struct _parallel_task* tasks, size_t count) {
+    /* =========== VARIABLES ========== */
+
+    pthread_t threads[PARALLEL_MAX_THREADS];
+
+    /* Whether a thread was started for the segment */
+    int started[PARALLEL_MAX_THREADS] = { 0 };
+
+    /* ================================= */
+
+
+
+    for (size_t i = 1; i < count; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, __Parallel_worker, &tasks[i]) == 0);
+    }
+
+    __Parallel_worker(&tasks[0]);
+
+    for (size_t i = 1; i < count; i++) {
+
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+        else {
+            __Parallel_worker(&tasks[i]);
+        }
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+Node_t List_parallel_find(const List_t list, const Data data, match_fptr match, size_t threads) {
+    /* =========== VARIABLES ========== */
+
+    struct _parallel_job job;
+
+    struct _parallel_task tasks[PARALLEL_MAX_THREADS];
+
+    /* Number of segments */
+    size_t count = 0;
+
+    /* Lowest segment with a match */
+    size_t found = 0;
+
+    /* Node we are looking for */
+    Node_t node = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list == NULL) {
+        LIST_WARN(__func__, "provided list is NULL");
+
+        return NULL;
+    }
+
+    if (data == NULL) {
+        return NULL;
+    }
+
+    /* ============= Make sure there is a function to use ============= */
+    if ((list->match == NULL) && (match == NULL)) {
+        LIST_WARN(__func__, "there is no associated `match` function with the given list");
+
+        return NULL;
+    }
+
+    /* ================================= */
+
+    memset(&job, 0, sizeof(struct _parallel_job));
+
+    job.op = PARALLEL_FIND;
+
+    /* =============== Cast to avoid a warning message ================ */
+    job.data = (Data) data;
+
+    /* Use alternative match function if provided */
+    job.match = (match != NULL) ? match : list->match;
+
+    atomic_init(&job.found, SIZE_MAX);
+
+    List_lock_read(list);
+
+    count = __Parallel_split(list, &job, tasks, threads);
+
+    __Parallel_run(tasks, count);
+
+    List_unlock(list);
+
+    /* The match of the lowest segment is the first one in the list */
+    if ((found = atomic_load(&job.found)) < count) {
+        node = tasks[found].node;
+    }
+
+    /* ================================= */
+
+    return node;
+}
+
+/* ================================================================ */
+
+size_t List_parallel_find_all(const List_t list, const Data data, match_fptr match, Node_t* nodes, size_t max, size_t threads) {
+    /* =========== VARIABLES ========== */
+
+    struct _parallel_job job;
+
+    struct _parallel_task tasks[PARALLEL_MAX_THREADS];
+
+    /* Room for the nodes found by all segments and its capacity */
+    Node_t* buffer = NULL;
+
+    size_t room = 0;
+
+    /* Number of segments */
+    size_t count = 0;
+
+    /* Number of matching nodes */
+    size_t total = 0;
+
+    /* Number of nodes stored in the nodes array */
+    size_t stored = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list == NULL) {
+        LIST_WARN(__func__, "provided list is NULL");
+
+        return 0;
+    }
+
+    if (data == NULL) {
+        return 0;
+    }
+
+    /* ============= Make sure there is a function to use ============= */
+    if ((list->match == NULL) && (match == NULL)) {
+        LIST_WARN(__func__, "there is no associated `match` function with the given list");
+
+        return 0;
+    }
+
+    /* ================================= */
+
+    memset(&job, 0, sizeof(struct _parallel_job));
+
+    job.op = PARALLEL_FIND_ALL;
+
+    /* =============== Cast to avoid a warning message ================ */
+    job.data = (Data) data;
+
+    /* Use alternative match function if provided */
+    job.match = (match != NULL) ? match : list->match;
+
+    List_lock_read(list);
+
+    count = __Parallel_split(list, &job, tasks, threads);
+
+    /* ================================================================ */
+    /* == A segment may fill the nodes array up to its own length ===== */
+    /* ================================================================ */
+
+    if ((nodes != NULL) && (max > 0) && (list->size > 0)) {
+
+        /* At most list->size nodes in total, and at most count * max */
+        for (size_t i = 0; i < count; i++) {
+            tasks[i].max = (max < tasks[i].length) ? max : tasks[i].length;
+
+            room += tasks[i].max;
+        }
+
+        if ((buffer = (Node_t*) malloc(room * sizeof(Node_t))) == NULL) {
+            LIST_WARN_SYS(__func__);
+
+            List_unlock(list);
+
+            return 0;
+        }
+
+        for (size_t i = 0, offset = 0; i < count; offset += tasks[i].max, i++) {
+            tasks[i].nodes = buffer + offset;
+        }
+    }
+
+    __Parallel_run(tasks, count);
+
+    List_unlock(list);
+
+    /* ================================================================ */
+    /* ============= Gather the nodes in the list order =============== */
+    /* ================================================================ */
+
+    for (size_t i = 0; i < count; i++) {
+
+        for (size_t j = 0; (j < tasks[i].count) && (j < tasks[i].max) && (stored < max); j++) {
+            nodes[stored++] = tasks[i].nodes[j];
+        }
+
+        total += tasks[i].count;
+    }
+
+    free(buffer);
+
+    /* ================================= */
+
+    return total;
+}
+
+/* ================================================================ */
+
+int List_parallel_for_each(const List_t list, visit_fptr visit, void* arg, size_t threads) {
+    /* =========== VARIABLES ========== */
+
+    struct _parallel_job job;
+
+    struct _parallel_task tasks[PARALLEL_MAX_THREADS];
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if ((list != NULL) && (visit != NULL)) {
+
+        memset(&job, 0, sizeof(struct _parallel_job));
+
+        job.op = PARALLEL_FOR_EACH;
+
+        job.visit = visit;
+
+        job.arg = arg;
+
+        List_lock_read(list);
+
+        __Parallel_run(tasks, __Parallel_split(list, &job, tasks, threads));
+
+        List_unlock(list);
+
+        /* ================================= */
+
+        result = 0;
+    }
+    else {
+        LIST_WARN(__func__, "provided list or function is NULL");
+    }
+
+    /* ================================= */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int List_parallel_reduce(const List_t list, reduce_fptr reduce, combine_fptr combine, void* result, size_t result_size, size_t threads) {
+    /* =========== VARIABLES ========== */
+
+    struct _parallel_job job;
+
+    struct _parallel_task tasks[PARALLEL_MAX_THREADS];
+
+    /* Accumulators of all segments */
+    char* accs = NULL;
+
+    /* Number of segments */
+    size_t count = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ============ Make sure the arguments are not NULL ============== */
+    /* ================================================================ */
+
+    if ((list == NULL) || (reduce == NULL) || (combine == NULL) || (result == NULL) || (result_size == 0)) {
+        LIST_WARN(__func__, "provided list, function or result is NULL");
+
+        return -1;
+    }
+
+    /* ================================= */
+
+    memset(&job, 0, sizeof(struct _parallel_job));
+
+    job.op = PARALLEL_REDUCE;
+
+    job.reduce = reduce;
+
+    List_lock_read(list);
+
+    count = __Parallel_split(list, &job, tasks, threads);
+
+    if ((accs = (char*) malloc(count * result_size)) == NULL) {
+        LIST_WARN_SYS(__func__);
+
+        List_unlock(list);
+
+        return -1;
+    }
+
+    /* Every segment starts from the identity value */
+    for (size_t i = 0; i < count; i++) {
+        tasks[i].acc = memcpy(accs + i * result_size, result, result_size);
+    }
+
+    __Parallel_run(tasks, count);
+
+    List_unlock(list);
+
+    /* ============= Combine partial results in list order ============ */
+    for (size_t i = 0; i < count; i++) {
+        combine(result, tasks[i].acc);
+    }
+
+    free(accs);
+
+    /* ================================= */
+
+    return 0;
+}
+
+/* ================================================================ */
@@ -0,0 +1,113 @@
+#ifndef PARALLEL_LIST_H
+#define PARALLEL_LIST_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../list.h"
+
+/* Lists are not split into segments shorter than this, shorter lists are scanned by the calling thread */
+#ifndef PARALLEL_MIN_SEGMENT
+    #define PARALLEL_MIN_SEGMENT 16384
+#endif
+
+/* Largest number of threads a single call uses */
+#define PARALLEL_MAX_THREADS 64
+
+/*
+ * The list is split into up to PARALLEL_MAX_THREADS segments whose first nodes are recorded in a skip
+ * array kept with the list. The array is rebuilt with a single walk only after the list has changed,
+ * so repeated traversals of an unchanged list start all threads right away. Every thread takes a run
+ * of consecutive segments, the calling thread takes the first one.
+ * Concurrent lists are locked for reading for the whole call, so callbacks must not change the list.
+*/
+
+/* ================================================================ */
+/* ====================== TYPES IMPLEMENTAION ===================== */
+/* ================================================================ */
+
+struct _list_segments {
+    /* Value of the list `changes` counter the segments were recorded at */
+    size_t changes;
+
+    /* Number of segments */
+    size_t count;
+
+    /* First node of every segment, the entry after the last segment is NULL */
+    struct _node* first[PARALLEL_MAX_THREADS + 1];
+};
+
+/* ================================================================ */
+/* ===================== Parallel List_t API ====================== */
+/* ================================================================ */
+
+/**
+ * Find the first node with the specified data, scanning segments in parallel.
+ * Threads scanning past an already found node stop early.
+ *
+ * @param list list to search in
+ * @param data data to be searched
+ * @param match function used to compare data, the list match function if NULL (must be thread-safe)
+ * @param threads number of threads to use, 0 for the number of online CPUs
+ *
+ * @return the same node as List_find on success, NULL on failure.
+*/
+extern Node_t List_parallel_find(const List_t list, const Data data, match_fptr match, size_t threads);
+
+/* ================================================================ */
+
+/**
+ * Find nodes with the specified data, scanning segments in parallel.
+ *
+ * @param list list to search in
+ * @param data data to be searched
+ * @param match function used to compare data, the list match function if NULL (must be thread-safe)
+ * @param nodes array that receives the first `max` matching nodes in list order, may be NULL
+ * @param max capacity of the nodes array
+ * @param threads number of threads to use, 0 for the number of online CPUs
+ *
+ * @return total number of matching nodes (may be greater than max), as List_find_all.
+*/
+extern size_t List_parallel_find_all(const List_t list, const Data data, match_fptr match, Node_t* nodes, size_t max, size_t threads);
+
+/* ================================================================ */
+
+/**
+ * Call a function on the data of every node. Segments are visited in parallel, so the order of calls
+ * across segments is not defined and the function must be safe to call from several threads.
+ *
+ * @param list list to walk through
+ * @param visit function called on every data
+ * @param arg argument passed to every call
+ * @param threads number of threads to use, 0 for the number of online CPUs
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_parallel_for_each(const List_t list, visit_fptr visit, void* arg, size_t threads);
+
+/* ================================================================ */
+
+/**
+ * Fold the data of all nodes into a result. Every segment is folded into its own copy of the initial
+ * result, then the partial results are combined in list order, so `reduce` and `combine` must give
+ * the sequential fold when the initial result is an identity value (e.g. 0 for a sum).
+ *
+ * @param list list to be folded
+ * @param reduce function that folds data into an accumulator
+ * @param combine function that folds a partial accumulator into another one
+ * @param result identity value on input, the folded value on output
+ * @param result_size size of the result in bytes
+ * @param threads number of threads to use, 0 for the number of online CPUs
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int List_parallel_reduce(const List_t list, reduce_fptr reduce, combine_fptr combine, void* result, size_t result_size, size_t threads);
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
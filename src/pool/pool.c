@@ -0,0 +1,343 @@
+#include "pool.h"
+
+/* Alignment of items handed out by a pool */
+#define POOL_ALIGN 16
+
+/* Round the size up to the alignment boundary */
+#define POOL_ROUND(size) (((size) + (POOL_ALIGN - 1)) & ~((size_t) POOL_ALIGN - 1))
+
+/* ================================================================ */
+/* ============================ STATIC ============================ */
+/* ================================================================ */
+
+/**
+ * Allocate a new chunk and make it the current one.
+ *
+ * @param pool pool to grow
+ * @param items number of items in the new chunk
+ *
+ * @return 0 on success, negative value on failure.
+*/
+static int __Pool_grow(const Pool_t pool, size_t items) {
+    /* =========== VARIABLES ========== */
+
+    /* Chunk we are allocating */
+    struct _pool_chunk* chunk = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ============ Dynamically allocate memory for a chunk =========== */
+    /* ================================================================ */
+
+    if ((chunk = (struct _pool_chunk*) malloc(POOL_ROUND(sizeof(struct _pool_chunk)) + pool->item_size * items)) != NULL) {
+
+        chunk->next = pool->chunks;
+
+        pool->chunks = chunk;
+
+        /* Items start right after the (aligned) chunk header */
+        pool->cursor = (char*) chunk + POOL_ROUND(sizeof(struct _pool_chunk));
+
+        pool->end = pool->cursor + pool->item_size * items;
+
+        /* ================================= */
+
+        result = 0;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return result;
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+Pool_t Pool_create(size_t item_size, size_t chunk_items) {
+    /* =========== VARIABLES ========== */
+
+    /* Pool we are creating */
+    Pool_t pool = NULL;
+
+    /* ================================= */
+
+
+
+    if (item_size == 0) {
+        LIST_WARN(__func__, "item size must be greater than 0");
+
+        return NULL;
+    }
+
+    /* ================================================================ */
+    /* ============ Dynamically allocate memory for a pool ============ */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((pool = (Pool_t) malloc(sizeof(struct _pool))) != NULL) {
+
+        /* Clear the memory/set some of the fields to its initial values */
+        memset(pool, 0, sizeof(struct _pool));
+
+        /* ================================= */
+
+        /* A released item stores the free list link in itself */
+        pool->item_size = POOL_ROUND((item_size < sizeof(void*)) ? sizeof(void*) : item_size);
+
+        pool->chunk_items = (chunk_items > 0) ? chunk_items : POOL_DEFAULT_CHUNK;
+
+        pool->refs = 1;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return pool;
+}
+
+/* ================================================================ */
+
+void* Pool_alloc(const Pool_t pool) {
+    /* =========== VARIABLES ========== */
+
+    /* Item we are handing out */
+    void* item = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a pool is not NULL ================= */
+    /* ================================================================ */
+
+    if (pool != NULL) {
+
+        /* Reuse a released item first */
+        if (pool->free != NULL) {
+            item = pool->free;
+
+            pool->free = *((void**) item);
+        }
+        /* Then carve the current chunk, growing the pool when it is exhausted */
+        else if ((pool->cursor != pool->end) || (__Pool_grow(pool, pool->chunk_items) == 0)) {
+            item = pool->cursor;
+
+            pool->cursor += pool->item_size;
+        }
+
+        /* __Pool_grow function will tell you if there is an error occured while chunk allocation */
+    }
+    else {
+        LIST_WARN(__func__, "provided pool is NULL");
+    }
+
+    /* ================================= */
+
+    return item;
+}
+
+/* ================================================================ */
+
+void Pool_free(const Pool_t pool, void* item) {
+
+    /* ================================================================ */
+    /* ================= Make sure a pool is not NULL ================= */
+    /* ================================================================ */
+
+    if (pool != NULL) {
+
+        if (item != NULL) {
+
+            /* Push the item onto the free list */
+            *((void**) item) = pool->free;
+
+            pool->free = item;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided pool is NULL");
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int Pool_reserve(const Pool_t pool, size_t items) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a pool is not NULL ================= */
+    /* ================================================================ */
+
+    if (pool != NULL) {
+
+        /* The current chunk is large enough */
+        if ((size_t) (pool->end - pool->cursor) >= items * pool->item_size) {
+            return 0;
+        }
+
+        /* Hand the rest of the current chunk over to the free list, so it is not lost */
+        for (; pool->cursor != pool->end; pool->cursor += pool->item_size) {
+            Pool_free(pool, pool->cursor);
+        }
+
+        result = __Pool_grow(pool, (items > pool->chunk_items) ? items : pool->chunk_items);
+    }
+    else {
+        LIST_WARN(__func__, "provided pool is NULL");
+    }
+
+    /* ================================= */
+
+    return result;
+}
+
+/* ================================================================ */
+
+void* Pool_alloc_reserved(const Pool_t pool) {
+    /* =========== VARIABLES ========== */
+
+    /* Item we are handing out */
+    void* item = NULL;
+
+    /* ================================= */
+
+
+
+    /* Carve the current chunk, falling back to the regular path */
+    if ((pool != NULL) && (pool->cursor != pool->end)) {
+        item = pool->cursor;
+
+        pool->cursor += pool->item_size;
+    }
+    else {
+        item = Pool_alloc(pool);
+    }
+
+    /* ================================= */
+
+    return item;
+}
+
+/* ================================================================ */
+
+void Pool_clear(const Pool_t pool) {
+    /* =========== VARIABLES ========== */
+
+    /* Chunk that is being released */
+    struct _pool_chunk* chunk = NULL;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a pool is not NULL ================= */
+    /* ================================================================ */
+
+    if (pool != NULL) {
+
+        /* Release all chunks at once */
+        while ((chunk = pool->chunks) != NULL) {
+            pool->chunks = chunk->next;
+
+            free(chunk);
+        }
+
+        pool->free = NULL;
+
+        pool->cursor = pool->end = NULL;
+    }
+    else {
+        LIST_WARN(__func__, "provided pool is NULL");
+    }
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+Pool_t Pool_retain(const Pool_t pool) {
+
+    /* ================================================================ */
+    /* ================= Make sure a pool is not NULL ================= */
+    /* ================================================================ */
+
+    if (pool != NULL) {
+        pool->refs++;
+    }
+    else {
+        LIST_WARN(__func__, "provided pool is NULL");
+    }
+
+    /* ================================= */
+
+    return pool;
+}
+
+/* ================================================================ */
+
+int Pool_destroy(Pool_t* pool) {
+    /* =========== VARIABLES ========== */
+
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a pool is not NULL ================= */
+    /* ================================================================ */
+
+    if ((pool != NULL) && (*pool != NULL)) {
+
+        /* Only the last owner releases memory */
+        if (--(*pool)->refs == 0) {
+
+            /* Release all chunks at once, no matter how many items are still in use */
+            Pool_clear(*pool);
+
+            /* Clear memory */
+            LIST_SCRUB(*pool, sizeof(struct _pool));
+
+            /* Deallocate memory */
+            free(*pool);
+        }
+
+        *pool = NULL;
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
@@ -0,0 +1,163 @@
+#ifndef POOL_H
+#define POOL_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "../diagnostics/diagnostics.h"
+#include "../../guard/guard.h"
+
+/* Number of items in a chunk when 0 is passed to Pool_create */
+#define POOL_DEFAULT_CHUNK 256
+
+/* ================================================================ */
+/* ======================= TYPES DEFINITIONS ====================== */
+/* ================================================================ */
+
+/**
+ * A fixed-size item allocator that hands out items from pre-allocated chunks.
+ * A pool takes no lock: its owners must not use it from several threads at once.
+*/
+typedef struct _pool* Pool_t;
+
+/* ================================ */
+
+/* ================================================================ */
+/* ====================== TYPES IMPLEMENTAION ===================== */
+/* ================================================================ */
+
+struct _pool_chunk {
+    /* The next chunk in the pool */
+    struct _pool_chunk* next;
+};
+
+/* ================================ */
+
+struct _pool {
+    /* Size of a single item (rounded up to keep items aligned) */
+    size_t item_size;
+
+    /* Number of items in every chunk */
+    size_t chunk_items;
+
+    /* Items that have been released and can be handed out again */
+    void* free;
+
+    /* First never used item of the most recent chunk */
+    char* cursor;
+
+    /* End of the most recent chunk */
+    char* end;
+
+    /* All chunks allocated by the pool */
+    struct _pool_chunk* chunks;
+
+    /* Number of owners (lists) sharing the pool */
+    size_t refs;
+};
+
+/* ================================================================ */
+/* ========================== Pool_t API ========================== */
+/* ================================================================ */
+
+/**
+ * Allocate a new instance of a pool.
+ *
+ * @param item_size size of a single item handed out by the pool
+ * @param chunk_items number of items allocated at once, POOL_DEFAULT_CHUNK if 0
+ *
+ * @return a new instance of a pool on success, NULL on failure.
+*/
+extern Pool_t Pool_create(size_t item_size, size_t chunk_items);
+
+/* ================================================================ */
+
+/**
+ * Take an item from the pool.
+ *
+ * @param pool pool to allocate from
+ *
+ * @return pointer to an uninitialized item on success, NULL on failure.
+*/
+extern void* Pool_alloc(const Pool_t pool);
+
+/* ================================================================ */
+
+/**
+ * Return an item to the pool. The item must have been taken from the same pool.
+ *
+ * @param pool pool the item belongs to
+ * @param item item to be released
+ *
+ * @return none.
+*/
+extern void Pool_free(const Pool_t pool, void* item);
+
+/* ================================================================ */
+
+/**
+ * Make sure the next items taken with Pool_alloc_reserved come from one contiguous chunk,
+ * allocating that chunk (at once) if the current one is too small.
+ *
+ * @param pool pool to reserve items in
+ * @param items number of items to reserve
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int Pool_reserve(const Pool_t pool, size_t items);
+
+/* ================================================================ */
+
+/**
+ * Take the next item of the current chunk, bypassing released items. Used after Pool_reserve.
+ *
+ * @param pool pool to allocate from
+ *
+ * @return pointer to an uninitialized item on success, NULL on failure.
+*/
+extern void* Pool_alloc_reserved(const Pool_t pool);
+
+/* ================================================================ */
+
+/**
+ * Release all chunks of the pool at once, invalidating every item taken from it.
+ * The pool itself stays usable.
+ *
+ * @param pool pool to be cleared
+ *
+ * @return none.
+*/
+extern void Pool_clear(const Pool_t pool);
+
+/* ================================================================ */
+
+/**
+ * Register one more owner of the pool.
+ *
+ * @param pool pool to be shared
+ *
+ * @return the same pool.
+*/
+extern Pool_t Pool_retain(const Pool_t pool);
+
+/* ================================================================ */
+
+/**
+ * Drop one owner of the pool. When the last owner is gone, all chunks are released at once.
+ *
+ * @param pool pool to be destroyed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int Pool_destroy(Pool_t* pool);
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
@@ -0,0 +1,453 @@
+#include "../list.h"
+
+/* Seed of the generator of tower heights, any value but 0 */
+#define SKIP_SEED 0x9E3779B97F4A7C15ULL
+
+/* The node is ordered before data, or not after it if `after` is set */
+#define SKIP_BEFORE(skip, node, data, after) \
+    ((after) ? ((skip)->order((node)->data, (data)) <= 0) : ((skip)->order((node)->data, (data)) < 0))
+
+/* ================================================================ */
+/* ============================ STATIC ============================ */
+/* ================================================================ */
+
+/**
+ * Choose the height of a tower for a new node.
+ *
+ * @param skip skip list levels the tower is for
+ *
+ * @return number of levels, 0 if the node gets no tower.
+*/
+static size_t __Skip_height(const Skip_t skip) {
+    /* =========== VARIABLES ========== */
+
+    /* Random bits, SKIP_FANOUT - 1 of every group have to be zero to go one level higher */
+    uint64_t bits = 0;
+
+    size_t height = 0;
+
+    /* ================================= */
+
+
+
+    /* xorshift64 */
+    skip->seed ^= skip->seed << 13;
+    skip->seed ^= skip->seed >> 7;
+    skip->seed ^= skip->seed << 17;
+
+    for (bits = skip->seed; (height < SKIP_MAX_LEVEL) && ((bits & (SKIP_FANOUT - 1)) == 0); bits /= SKIP_FANOUT) {
+        height++;
+    }
+
+    /* ================================= */
+
+    return height;
+}
+
+/* ================================================================ */
+
+/**
+ * Allocate a tower.
+ *
+ * @param node node the tower stands on
+ * @param height number of levels
+ *
+ * @return a new tower with no links on success, NULL on failure.
+*/
+static struct _skip_tower* __Skip_tower(struct _node* node, size_t height) {
+    /* =========== VARIABLES ========== */
+
+    /* Tower we are creating */
+    struct _skip_tower* tower = NULL;
+
+    /* ================================= */
+
+
+
+    if ((tower = (struct _skip_tower*) calloc(1, sizeof(struct _skip_tower) + height * sizeof(struct _skip_link))) != NULL) {
+
+        tower->node = node;
+
+        tower->height = height;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return tower;
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+Skip_t Skip_create(match_fptr order) {
+    /* =========== VARIABLES ========== */
+
+    /* Skip list levels we are creating */
+    Skip_t skip = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ======= Dynamically allocate memory for skip list levels ======= */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((skip = (Skip_t) malloc(sizeof(struct _skip))) != NULL) {
+
+        /* Clear the memory/set some of the fields to its initial values */
+        memset(skip, 0, sizeof(struct _skip));
+
+        /* ================================= */
+
+        skip->order = order;
+
+        skip->seed = SKIP_SEED;
+
+        if ((skip->head = __Skip_tower(NULL, SKIP_MAX_LEVEL)) == NULL) {
+            free(skip);
+
+            skip = NULL;
+        }
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return skip;
+}
+
+/* ================================================================ */
+
+int Skip_build(const Skip_t skip, struct _node* first) {
+    /* =========== VARIABLES ========== */
+
+    /* The last tower of every level so far and the position of its node */
+    struct _skip_tower* last[SKIP_MAX_LEVEL];
+
+    size_t rank[SKIP_MAX_LEVEL];
+
+    /* Tower we are creating */
+    struct _skip_tower* tower = NULL;
+
+    /* Node we are using to traverse the chain and the one before it */
+    struct _node* node = NULL;
+    struct _node* prev = NULL;
+
+    /* Position of the node */
+    size_t position = 1;
+
+    size_t height = 0;
+
+    /* ================================= */
+
+
+
+    if (skip == NULL) {
+        LIST_WARN(__func__, "provided skip list levels are NULL");
+
+        return -1;
+    }
+
+    Skip_clear(skip);
+
+    for (size_t level = 0; level < SKIP_MAX_LEVEL; level++) {
+        last[level] = skip->head;
+
+        rank[level] = 0;
+    }
+
+    skip->sorted = (skip->order != NULL);
+
+    /* ================================================================ */
+    /* ============= Raise towers walking the chain once ============== */
+    /* ================================================================ */
+
+    for (node = first; node != NULL; prev = node, node = node->next, position++) {
+
+        if (skip->sorted && (prev != NULL) && (skip->order(prev->data, node->data) > 0)) {
+            skip->sorted = 0;
+        }
+
+        if ((height = __Skip_height(skip)) == 0) {
+            continue ;
+        }
+
+        if ((tower = __Skip_tower(node, height)) == NULL) {
+            Skip_clear(skip);
+
+            return -1;
+        }
+
+        for (size_t level = 0; level < height; level++) {
+
+            last[level]->level[level].next = tower;
+
+            last[level]->level[level].width = position - rank[level];
+
+            last[level] = tower;
+
+            rank[level] = position;
+        }
+
+        if (height > skip->height) {
+            skip->height = height;
+        }
+    }
+
+    /* ================================= */
+
+    return 0;
+}
+
+/* ================================================================ */
+
+struct _node* Skip_at(const Skip_t skip, struct _node* first, size_t index, size_t* hops) {
+    /* =========== VARIABLES ========== */
+
+    /* Tower we are using to descend the levels */
+    struct _skip_tower* tower = skip->head;
+
+    /* Position of the tower node, and of the node being searched */
+    size_t rank = 0;
+
+    size_t target = index + 1;
+
+    /* Node we are using to traverse the chain */
+    struct _node* node = NULL;
+
+    /* Towers and nodes stepped over */
+    size_t steps = 0;
+
+    /* ================================= */
+
+
+
+    /* Go as far as possible on every level, from the top one */
+    for (size_t level = skip->height; level-- > 0; ) {
+
+        while ((tower->level[level].next != NULL) && (rank + tower->level[level].width <= target)) {
+
+            rank += tower->level[level].width;
+
+            tower = tower->level[level].next;
+
+            steps++;
+        }
+    }
+
+    /* The head tower stands before the first node */
+    if (tower->node == NULL) {
+        node = first;
+
+        rank = 1;
+    }
+    else {
+        node = tower->node;
+    }
+
+    /* Less than SKIP_FANOUT nodes are left on average */
+    for (; rank < target; rank++, steps++) {
+        node = node->next;
+    }
+
+    if (hops != NULL) {
+        *hops += steps;
+    }
+
+    /* ================================= */
+
+    return node;
+}
+
+/* ================================================================ */
+
+struct _node* Skip_search(const Skip_t skip, struct _node* first, const Data data, int after, struct _skip_path* path, size_t* hops) {
+    /* =========== VARIABLES ========== */
+
+    /* Tower we are using to descend the levels */
+    struct _skip_tower* tower = skip->head;
+
+    /* Position of the tower node */
+    size_t rank = 0;
+
+    /* Node we are using to traverse the chain and the one before it */
+    struct _node* node = NULL;
+    struct _node* prev = NULL;
+
+    /* Towers and nodes stepped over */
+    size_t steps = 0;
+
+    /* ================================= */
+
+
+
+    /* Go as far as possible on every level, from the top one. Levels above the used ones hold the head tower */
+    for (size_t level = SKIP_MAX_LEVEL; level-- > 0; ) {
+
+        if (level < skip->height) {
+
+            while ((tower->level[level].next != NULL) && SKIP_BEFORE(skip, tower->level[level].next->node, data, after)) {
+
+                rank += tower->level[level].width;
+
+                tower = tower->level[level].next;
+
+                steps++;
+            }
+        }
+
+        if (path != NULL) {
+            path->tower[level] = tower;
+
+            path->rank[level] = rank;
+        }
+    }
+
+    /* ============ Walk the chain from the lowest tower ============== */
+    prev = tower->node;
+
+    for (node = (prev != NULL) ? prev->next : first; (node != NULL) && SKIP_BEFORE(skip, node, data, after); node = node->next) {
+
+        prev = node;
+
+        rank++;
+
+        steps++;
+    }
+
+    if (path != NULL) {
+        path->prev_rank = rank;
+    }
+
+    if (hops != NULL) {
+        *hops += steps;
+    }
+
+    /* ================================= */
+
+    return prev;
+}
+
+/* ================================================================ */
+
+int Skip_link(const Skip_t skip, const struct _skip_path* path, struct _node* node) {
+    /* =========== VARIABLES ========== */
+
+    /* Tower we are creating */
+    struct _skip_tower* tower = NULL;
+
+    /* Tower that precedes the node on a level */
+    struct _skip_tower* prev = NULL;
+
+    /* Position of the node */
+    size_t position = path->prev_rank + 1;
+
+    size_t height = __Skip_height(skip);
+
+    /* ================================= */
+
+
+
+    if ((height > 0) && ((tower = __Skip_tower(node, height)) == NULL)) {
+        Skip_clear(skip);
+
+        return -1;
+    }
+
+    if (height > skip->height) {
+        skip->height = height;
+    }
+
+    /* ================================================================ */
+    /* ====== Split the links the tower cuts, widen the ones above ==== */
+    /* ================================================================ */
+
+    for (size_t level = 0; level < skip->height; level++) {
+
+        prev = path->tower[level];
+
+        if (level < height) {
+
+            if ((tower->level[level].next = prev->level[level].next) != NULL) {
+                tower->level[level].width = path->rank[level] + prev->level[level].width + 1 - position;
+            }
+
+            prev->level[level].next = tower;
+
+            prev->level[level].width = position - path->rank[level];
+        }
+        else if (prev->level[level].next != NULL) {
+            prev->level[level].width++;
+        }
+    }
+
+    /* ================================= */
+
+    return 0;
+}
+
+/* ================================================================ */
+
+void Skip_clear(const Skip_t skip) {
+    /* =========== VARIABLES ========== */
+
+    /* Tower that is being released */
+    struct _skip_tower* tower = NULL;
+
+    /* Tower that follows the released one */
+    struct _skip_tower* next = NULL;
+
+    /* ================================= */
+
+
+
+    if (skip == NULL) {
+        return ;
+    }
+
+    /* Every tower is on the lowest level */
+    for (tower = skip->head->level[0].next; tower != NULL; tower = next) {
+        next = tower->level[0].next;
+
+        free(tower);
+    }
+
+    memset(skip->head->level, 0, SKIP_MAX_LEVEL * sizeof(struct _skip_link));
+
+    skip->height = 0;
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int Skip_destroy(Skip_t* skip) {
+
+    if ((skip == NULL) || (*skip == NULL)) {
+        return -1;
+    }
+
+    Skip_clear(*skip);
+
+    free((*skip)->head);
+
+    free(*skip);
+
+    *skip = NULL;
+
+    /* ================================= */
+
+    return 0;
+}
+
+/* ================================================================ */
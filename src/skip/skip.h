@@ -0,0 +1,199 @@
+#ifndef SKIP_H
+#define SKIP_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "../data/data.h"
+#include "../diagnostics/diagnostics.h"
+#include "../../guard/guard.h"
+
+/* Largest number of levels above the node chain */
+#define SKIP_MAX_LEVEL 24
+
+/* A tower is one level taller than the one below it with probability 1 / SKIP_FANOUT (a power of two) */
+#define SKIP_FANOUT 4
+
+/*
+ * Skip list levels built over a chain of list nodes. The chain itself is the lowest level, towers
+ * stand on about every SKIP_FANOUT-th node and link to the next towers of their levels, recording how
+ * many nodes every link passes over. This gives O(log n) access by position, and O(log n) searches
+ * while the chain is sorted by the order function.
+ * Towers only refer to nodes; the caller keeps them in step with the chain (see Skip_build, Skip_link).
+*/
+
+struct _node;
+
+/* ================================================================ */
+/* ======================= TYPES DEFINITIONS ====================== */
+/* ================================================================ */
+
+/**
+ * Skip list levels over a chain of list nodes
+*/
+typedef struct _skip* Skip_t;
+
+/* ================================ */
+
+/* ================================================================ */
+/* ====================== TYPES IMPLEMENTAION ===================== */
+/* ================================================================ */
+
+struct _skip_tower;
+
+struct _skip_link {
+    /* Next tower on the level, NULL if there is none */
+    struct _skip_tower* next;
+
+    /* Number of nodes from the tower node to the next tower node, valid if there is a next tower */
+    size_t width;
+};
+
+struct _skip_tower {
+    /* Node the tower stands on, NULL for the head tower that precedes the chain */
+    struct _node* node;
+
+    /* Number of levels */
+    size_t height;
+
+    /* Links of every level, from the lowest one */
+    struct _skip_link level[];
+};
+
+/* ================================ */
+
+struct _skip {
+    /* Tower that precedes the chain, SKIP_MAX_LEVEL levels high */
+    struct _skip_tower* head;
+
+    /* Number of levels in use */
+    size_t height;
+
+    /* Value of the list `changes` counter the towers were built at */
+    size_t changes;
+
+    /* Non-zero if the chain was sorted by `order` when the towers were built */
+    int sorted;
+
+    /* State of the generator of tower heights */
+    uint64_t seed;
+
+    /* The encapsulated order function passed to Skip_create */
+    match_fptr order;
+};
+
+/* ================================ */
+
+/* Towers that precede a place in the chain on every level, filled in by Skip_search */
+struct _skip_path {
+    /* The last tower before the place on every level */
+    struct _skip_tower* tower[SKIP_MAX_LEVEL];
+
+    /* Position of every such tower node (1 for the first node, 0 for the head tower) */
+    size_t rank[SKIP_MAX_LEVEL];
+
+    /* Position of the node that precedes the place, 0 if the place is the beginning of the chain */
+    size_t prev_rank;
+};
+
+/* ================================================================ */
+/* ========================== Skip_t API ========================== */
+/* ================================================================ */
+
+/**
+ * Allocate new skip list levels without towers.
+ *
+ * @param order function that orders data (negative, 0, positive), may be NULL for positional access only
+ *
+ * @return new skip list levels on success, NULL on failure.
+*/
+extern Skip_t Skip_create(match_fptr order);
+
+/* ================================================================ */
+
+/**
+ * Build the towers over a chain from scratch, dropping the old ones, and check whether the chain is sorted.
+ *
+ * @param skip skip list levels to be built
+ * @param first first node of the chain, NULL if the chain is empty
+ *
+ * @return 0 on success, negative value on failure (no towers are left then).
+*/
+extern int Skip_build(const Skip_t skip, struct _node* first);
+
+/* ================================================================ */
+
+/**
+ * Find the node at the position.
+ *
+ * @param skip skip list levels built over the chain
+ * @param first first node of the chain
+ * @param index position of the node, 0 for the first one (less than the chain length)
+ * @param hops counter that grows by the number of towers and nodes stepped over, may be NULL
+ *
+ * @return node at the position.
+*/
+extern struct _node* Skip_at(const Skip_t skip, struct _node* first, size_t index, size_t* hops);
+
+/* ================================================================ */
+
+/**
+ * Find the place for data in a sorted chain: the last node ordered before it (or not after it).
+ *
+ * @param skip skip list levels built over a sorted chain
+ * @param first first node of the chain
+ * @param data data to be placed
+ * @param after non-zero to place data after nodes equal to it, zero to place it before them
+ * @param path structure that receives the towers preceding the place, may be NULL
+ * @param hops counter that grows by the number of towers and nodes stepped over, may be NULL
+ *
+ * @return the node that precedes the place, NULL if the place is the beginning of the chain.
+*/
+extern struct _node* Skip_search(const Skip_t skip, struct _node* first, const Data data, int after, struct _skip_path* path, size_t* hops);
+
+/* ================================================================ */
+
+/**
+ * Account for a node linked into the chain at the place found by Skip_search, raising a tower on it if chosen to.
+ * On failure the towers are dropped and have to be built again.
+ *
+ * @param skip skip list levels the place was found in
+ * @param path towers preceding the place
+ * @param node node that now follows the place
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int Skip_link(const Skip_t skip, const struct _skip_path* path, struct _node* node);
+
+/* ================================================================ */
+
+/**
+ * Drop all towers.
+ *
+ * @param skip skip list levels to be cleared
+ *
+ * @return none.
+*/
+extern void Skip_clear(const Skip_t skip);
+
+/* ================================================================ */
+
+/**
+ * Destroy the skip list levels. Nodes are not touched.
+ *
+ * @param skip skip list levels to be destroyed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int Skip_destroy(Skip_t* skip);
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
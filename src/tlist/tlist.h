@@ -0,0 +1,254 @@
+#ifndef TYPED_LIST_H
+#define TYPED_LIST_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../pool/pool.h"
+#include "../diagnostics/diagnostics.h"
+#include "../../guard/guard.h"
+
+/*
+ * A singly linked list specialized for one value type at compile time. Values are stored inline in
+ * the nodes (no allocation per value besides the node, which comes from a private pool), and the
+ * comparison and destruction are macros or functions known at compile time, so they can be inlined.
+ *
+ * `TLIST_DEFINE(IntList, int, TLIST_EQ, TLIST_NO_DESTROY)` generates:
+ *  IntList_t IntList_create(void)
+ *  int       IntList_insert_first(IntList_t list, int value)
+ *  int       IntList_insert_last(IntList_t list, int value)
+ *  int*      IntList_find(IntList_t list, int value)           - stored value or NULL
+ *  int       IntList_remove_first(IntList_t list, int* value)  - hands the value over if `value` is not NULL
+ *  int       IntList_remove(IntList_t list, int value)         - the first matching value
+ *  int       IntList_destroy(IntList_t* list)
+ * and the types `struct IntList`, `struct IntList_node` with members `next` and `value`.
+*/
+
+/* Values match if they are equal with == */
+#define TLIST_EQ(a, b) ((a) == (b))
+
+/* Values do not own anything */
+#define TLIST_NO_DESTROY(value) ((void) 0)
+
+/**
+ * Walk through the nodes of a typed list, the value of the current node is `node->value`.
+ *
+ * @param list typed list to walk through (not NULL)
+ * @param node pointer to a node of the list type, used as the loop variable
+*/
+#define TLIST_FOREACH(list, node) \
+    for ((node) = (list)->head; (node) != NULL; (node) = (node)->next)
+
+/* ================================================================ */
+
+/**
+ * Generate a typed list, see above.
+ *
+ * @param name prefix of the generated types and functions
+ * @param type type of values, copied into nodes by assignment
+ * @param equal `equal(a, b)` non-zero if the values match
+ * @param destroy `destroy(value)` called on values that are removed without being handed over
+*/
+#define TLIST_DEFINE(name, type, equal, destroy)                                                        \
+                                                                                                        \
+struct name##_node {                                                                                    \
+    /* The next node in the sequence */                                                                 \
+    struct name##_node* next;                                                                           \
+                                                                                                        \
+    /* Value stored inline */                                                                           \
+    type value;                                                                                         \
+};                                                                                                      \
+                                                                                                        \
+struct name {                                                                                           \
+    /* Number of elements in the list */                                                                \
+    size_t size;                                                                                        \
+                                                                                                        \
+    /* First and last elements of the list */                                                           \
+    struct name##_node* head;                                                                           \
+                                                                                                        \
+    struct name##_node* tail;                                                                           \
+                                                                                                        \
+    /* Private pool the nodes are taken from */                                                         \
+    Pool_t pool;                                                                                        \
+};                                                                                                      \
+                                                                                                        \
+typedef struct name* name##_t;                                                                          \
+                                                                                                        \
+static inline name##_t name##_create(void) {                                                            \
+    name##_t list = (name##_t) calloc(1, sizeof(struct name));                                          \
+                                                                                                        \
+    if (list == NULL) {                                                                                 \
+        LIST_WARN_SYS(__func__);                                                                        \
+    }                                                                                                   \
+    else if ((list->pool = Pool_create(sizeof(struct name##_node), 0)) == NULL) {                       \
+        free(list);                                                                                     \
+                                                                                                        \
+        list = NULL;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    return list;                                                                                        \
+}                                                                                                       \
+                                                                                                        \
+static inline struct name##_node* name##_node_alloc(const name##_t list, type value) {                  \
+    struct name##_node* node = NULL;                                                                    \
+                                                                                                        \
+    if (list == NULL) {                                                                                 \
+        LIST_WARN(__func__, "provided list is NULL");                                                   \
+    }                                                                                                   \
+    /* Pool_alloc function will tell you if there is an error occured while node allocation */          \
+    else if ((node = (struct name##_node*) Pool_alloc(list->pool)) != NULL) {                           \
+        node->value = value;                                                                            \
+                                                                                                        \
+        node->next = NULL;                                                                              \
+    }                                                                                                   \
+                                                                                                        \
+    return node;                                                                                        \
+}                                                                                                       \
+                                                                                                        \
+static inline int name##_insert_first(const name##_t list, type value) {                                \
+    struct name##_node* node = name##_node_alloc(list, value);                                          \
+                                                                                                        \
+    if (node == NULL) {                                                                                 \
+        return -1;                                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    if ((node->next = list->head) == NULL) {                                                            \
+        list->tail = node;                                                                              \
+    }                                                                                                   \
+                                                                                                        \
+    list->head = node;                                                                                  \
+                                                                                                        \
+    list->size++;                                                                                       \
+                                                                                                        \
+    return 0;                                                                                           \
+}                                                                                                       \
+                                                                                                        \
+static inline int name##_insert_last(const name##_t list, type value) {                                 \
+    struct name##_node* node = name##_node_alloc(list, value);                                          \
+                                                                                                        \
+    if (node == NULL) {                                                                                 \
+        return -1;                                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    if (list->tail == NULL) {                                                                           \
+        list->head = node;                                                                              \
+    }                                                                                                   \
+    else {                                                                                              \
+        list->tail->next = node;                                                                        \
+    }                                                                                                   \
+                                                                                                        \
+    list->tail = node;                                                                                  \
+                                                                                                        \
+    list->size++;                                                                                       \
+                                                                                                        \
+    return 0;                                                                                           \
+}                                                                                                       \
+                                                                                                        \
+static inline type* name##_find(const name##_t list, type value) {                                      \
+    struct name##_node* node = NULL;                                                                    \
+                                                                                                        \
+    if (list == NULL) {                                                                                 \
+        LIST_WARN(__func__, "provided list is NULL");                                                   \
+                                                                                                        \
+        return NULL;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    /* The comparison is compiled inline */                                                             \
+    for (node = list->head; (node != NULL) && !(equal(node->value, value)); node = node->next) ;        \
+                                                                                                        \
+    return (node != NULL) ? &node->value : NULL;                                                        \
+}                                                                                                       \
+                                                                                                        \
+static inline int name##_remove_first(const name##_t list, type* value) {                               \
+    struct name##_node* node = NULL;                                                                    \
+                                                                                                        \
+    if ((list == NULL) || ((node = list->head) == NULL)) {                                              \
+        return -1;                                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    if ((list->head = node->next) == NULL) {                                                            \
+        list->tail = NULL;                                                                              \
+    }                                                                                                   \
+                                                                                                        \
+    list->size--;                                                                                       \
+                                                                                                        \
+    /* Hand the value over or destroy it */                                                             \
+    if (value != NULL) {                                                                                \
+        *value = node->value;                                                                           \
+    }                                                                                                   \
+    else {                                                                                              \
+        destroy(node->value);                                                                           \
+    }                                                                                                   \
+                                                                                                        \
+    Pool_free(list->pool, node);                                                                        \
+                                                                                                        \
+    return 0;                                                                                           \
+}                                                                                                       \
+                                                                                                        \
+static inline int name##_remove(const name##_t list, type value) {                                      \
+    struct name##_node* prev = NULL;                                                                    \
+                                                                                                        \
+    struct name##_node* node = NULL;                                                                    \
+                                                                                                        \
+    if (list == NULL) {                                                                                 \
+        LIST_WARN(__func__, "provided list is NULL");                                                   \
+                                                                                                        \
+        return -1;                                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    for (node = list->head; (node != NULL) && !(equal(node->value, value)); prev = node, node = node->next) ; \
+                                                                                                        \
+    if (node == NULL) {                                                                                 \
+        return -1;                                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    /* Unlink the node */                                                                               \
+    if (prev == NULL) {                                                                                 \
+        list->head = node->next;                                                                        \
+    }                                                                                                   \
+    else {                                                                                              \
+        prev->next = node->next;                                                                        \
+    }                                                                                                   \
+                                                                                                        \
+    if (node == list->tail) {                                                                           \
+        list->tail = prev;                                                                              \
+    }                                                                                                   \
+                                                                                                        \
+    list->size--;                                                                                       \
+                                                                                                        \
+    destroy(node->value);                                                                               \
+                                                                                                        \
+    Pool_free(list->pool, node);                                                                        \
+                                                                                                        \
+    return 0;                                                                                           \
+}                                                                                                       \
+                                                                                                        \
+static inline int name##_destroy(name##_t* list) {                                                      \
+    struct name##_node* node = NULL;                                                                    \
+                                                                                                        \
+    if ((list == NULL) || (*list == NULL)) {                                                            \
+        return -1;                                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    for (node = (*list)->head; node != NULL; node = node->next) {                                       \
+        destroy(node->value);                                                                           \
+    }                                                                                                   \
+                                                                                                        \
+    /* Nodes go away together with the pool */                                                          \
+    Pool_destroy(&(*list)->pool);                                                                       \
+                                                                                                        \
+    free(*list);                                                                                        \
+                                                                                                        \
+    *list = NULL;                                                                                       \
+                                                                                                        \
+    return 0;                                                                                           \
+}
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
@@ -0,0 +1,918 @@
+#include "ulist.h"
+
+/* Vector versions of the key search are compiled for x86 with GCC or Clang, unless the build asks not to */
+#if !defined(ULIST_NO_SIMD) && defined(__GNUC__) && defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+    #define ULIST_SIMD 1
+
+    #include <immintrin.h>
+#endif
+
+/* Round a size up to the cache line boundary, as required by aligned_alloc */
+#define ULIST_ROUND(size) (((size) + (ULIST_ALIGN - 1)) & ~((size_t) ULIST_ALIGN - 1))
+
+/* The list keeps keys next to the data pointers */
+#define ULIST_KEYED(list) ((list)->find_key != NULL)
+
+/* ================================================================ */
+/* ============================ STATIC ============================ */
+/* ================================================================ */
+
+#ifndef ULIST_SIMD
+
+/**
+ * Find the key comparing keys one by one.
+ *
+ * @param block block to start from
+ * @param key key to be searched
+ * @param index where to store the slot index of the element
+ *
+ * @return block containing the key on success, NULL on failure.
+*/
+static UBlock_t __UBlock_find_scalar(UBlock_t block, int key, size_t* index) {
+    /* =========== VARIABLES ========== */
+
+    size_t i = 0;
+
+    /* ================================= */
+
+
+
+    for (; block != NULL; block = block->next) {
+
+        for (i = 0; (i < block->count) && (block->keys[i] != key); i++) ;
+
+        if (i < block->count) {
+            *index = i;
+
+            return block;
+        }
+    }
+
+    /* ================================= */
+
+    return NULL;
+}
+
+#else
+
+/**
+ * Find the key comparing 4 keys at once with SSE2. Lanes past the block count may hold stale keys,
+ * so a match there is the same as no match. Keys are padded to whole cache lines, so loads never
+ * leave the block.
+ *
+ * @param block block to start from
+ * @param key key to be searched
+ * @param index where to store the slot index of the element
+ *
+ * @return block containing the key on success, NULL on failure.
+*/
+static UBlock_t __UBlock_find_sse2(UBlock_t block, int key, size_t* index) {
+    /* =========== VARIABLES ========== */
+
+    __m128i needle = _mm_set1_epi32(key);
+
+    /* One bit per equal lane */
+    int mask = 0;
+
+    /* ================================= */
+
+
+
+    for (; block != NULL; block = block->next) {
+
+        /* Keys of the next block are on a cache line of their own */
+        if (block->next != NULL) {
+            __builtin_prefetch(block->next->keys);
+        }
+
+        for (size_t i = 0; i < block->count; i += 4) {
+
+            mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*) (block->keys + i)), needle)));
+
+            if (mask != 0) {
+
+                if ((i += (size_t) __builtin_ctz((unsigned int) mask)) < block->count) {
+                    *index = i;
+
+                    return block;
+                }
+
+                break ;
+            }
+        }
+    }
+
+    /* ================================= */
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+/**
+ * Find the key comparing 8 keys at once with AVX2, see __UBlock_find_sse2.
+*/
+__attribute__((target("avx2")))
+static UBlock_t __UBlock_find_avx2(UBlock_t block, int key, size_t* index) {
+    /* =========== VARIABLES ========== */
+
+    __m256i needle = _mm256_set1_epi32(key);
+
+    /* One bit per equal lane */
+    int mask = 0;
+
+    /* ================================= */
+
+
+
+    for (; block != NULL; block = block->next) {
+
+        /* Keys of the next block are on a cache line of their own */
+        if (block->next != NULL) {
+            __builtin_prefetch(block->next->keys);
+        }
+
+        for (size_t i = 0; i < block->count; i += 8) {
+
+            mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*) (block->keys + i)), needle)));
+
+            if (mask != 0) {
+
+                if ((i += (size_t) __builtin_ctz((unsigned int) mask)) < block->count) {
+                    *index = i;
+
+                    return block;
+                }
+
+                break ;
+            }
+        }
+    }
+
+    /* ================================= */
+
+    return NULL;
+}
+
+#endif
+
+/* ================================================================ */
+
+/**
+ * Create a new empty block and link it into the list right after the given block.
+ *
+ * @param list list to link into
+ * @param prev block that precedes the new block, NULL to make the new block the head
+ *
+ * @return A new instance of a block on success, NULL on failure.
+*/
+static UBlock_t __UBlock_create(const UList_t list, const UBlock_t prev) {
+    /* =========== VARIABLES ========== */
+
+    UBlock_t block = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ======== Dynamically allocate aligned memory for a block ======= */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((block = (UBlock_t) aligned_alloc(ULIST_ALIGN, list->block_size)) != NULL) {
+
+        block->count = 0;
+
+        /* Vector loads go past the last key, they must not read uninitialized memory */
+        if (ULIST_KEYED(list)) {
+            memset(block->keys, 0, list->block_size - sizeof(struct _ublock));
+        }
+
+        block->prev = prev;
+
+        block->next = (prev != NULL) ? prev->next : list->head;
+
+        /* Connect the new block with its neighbours */
+        if (block->next != NULL) {
+            block->next->prev = block;
+        }
+        else {
+            list->tail = block;
+        }
+
+        if (prev != NULL) {
+            prev->next = block;
+        }
+        else {
+            list->head = block;
+        }
+
+        list->blocks++;
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return block;
+}
+
+/* ================================================================ */
+
+/**
+ * Unlink the block from the list and destroy it. Data in the block is not touched.
+ *
+ * @param list list the block belongs to
+ * @param block block to be destroyed
+ *
+ * @return none.
+*/
+static void __UBlock_destroy(const UList_t list, UBlock_t block) {
+
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    }
+    else {
+        list->head = block->next;
+    }
+
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    }
+    else {
+        list->tail = block->prev;
+    }
+
+    list->blocks--;
+
+    /* Deallocate memory */
+    free(block);
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+/**
+ * Remove an element from the block. Empty blocks are released and
+ * a block that became less than half full absorbs its neighbour if they fit into one block.
+ *
+ * @param list list the block belongs to
+ * @param block block to remove from
+ * @param index index of the slot to be removed
+ *
+ * @return a pointer to data to be deleted.
+*/
+static Data __UList_remove_at(const UList_t list, const UBlock_t block, size_t index) {
+    /* =========== VARIABLES ========== */
+
+    /* Data to be deleted */
+    Data data = block->slots[index];
+
+    /* Block that follows the given one */
+    UBlock_t next = block->next;
+
+    /* ================================= */
+
+
+
+    /* Close the gap */
+    memmove(&block->slots[index], &block->slots[index + 1], (block->count - index - 1) * sizeof(Data));
+
+    if (ULIST_KEYED(list)) {
+        memmove(&block->keys[index], &block->keys[index + 1], (block->count - index - 1) * sizeof(int));
+    }
+
+    block->count--;
+
+    list->size--;
+
+    /* ================================================================ */
+    /* ============ Keep blocks dense to keep scans short ============= */
+    /* ================================================================ */
+
+    if (block->count == 0) {
+        __UBlock_destroy(list, block);
+    }
+    else if ((block->count < ULIST_SLOTS / 2) && (next != NULL) && (block->count + next->count <= ULIST_SLOTS)) {
+
+        memcpy(&block->slots[block->count], next->slots, next->count * sizeof(Data));
+
+        if (ULIST_KEYED(list)) {
+            memcpy(&block->keys[block->count], next->keys, next->count * sizeof(int));
+        }
+
+        block->count += next->count;
+
+        __UBlock_destroy(list, next);
+    }
+
+    /* ================================= */
+
+    return data;
+}
+
+/* ================================================================ */
+
+/**
+ * Locate the first element that matches specified data.
+ *
+ * @param list list to search in
+ * @param data data to be searched
+ * @param match match function used to compare data in the list
+ * @param index where to store the slot index of the element
+ *
+ * @return block containing the element on success, NULL on failure.
+*/
+static UBlock_t __UList_locate(const UList_t list, const Data data, match_fptr match, size_t* index) {
+    /* =========== VARIABLES ========== */
+
+    /* Block we are using to traverse the list */
+    UBlock_t block = NULL;
+
+    /* Slot we are using to traverse a block */
+    size_t i = 0;
+
+    /* ================================= */
+
+
+
+    /* Every block is scanned as a small array before moving to the next one */
+    for (block = list->head; block != NULL; block = block->next) {
+
+        for (i = 0; i < block->count; i++) {
+
+            if (match(block->slots[i], data) == 0) {
+                *index = i;
+
+                return block;
+            }
+        }
+    }
+
+    /* ================================= */
+
+    return NULL;
+}
+
+/* ================================================================ */
+/* ============================ EXTERN ============================ */
+/* ================================================================ */
+
+UList_t UList_create(destroy_fptr destroy, print_fptr print, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    UList_t list = NULL;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ======= Dynamically allocate memory for an unrolled list ======= */
+    /* ============= YOU NEED TO CALL free ON THIS OBJECT ============= */
+    /* ================================================================ */
+
+    if ((list = (UList_t) malloc(sizeof(struct _unrolled_list))) != NULL) {
+
+        /* Clear the memory/set some of the fields to its initial values */
+        memset(list, 0, sizeof(struct _unrolled_list));
+
+        /* ================================= */
+
+        list->destroy = destroy;
+
+        list->print = print;
+
+        list->match = match;
+
+        list->block_size = ULIST_ROUND(sizeof(struct _ublock));
+    }
+    else {
+        LIST_WARN_SYS(__func__);
+    }
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+UList_t UList_create_int(destroy_fptr destroy, print_fptr print, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* List we are creating */
+    UList_t list = NULL;
+
+    /* ================================= */
+
+
+
+    if ((list = UList_create(destroy, print, match)) != NULL) {
+
+        /* Keys are padded to whole cache lines, so vector loads never leave the block */
+        list->block_size = ULIST_ROUND(sizeof(struct _ublock)) + ULIST_ROUND(ULIST_SLOTS * sizeof(int));
+
+        /* ============ Pick the widest vector the CPU supports =========== */
+#ifdef ULIST_SIMD
+        __builtin_cpu_init();
+
+        list->find_key = __builtin_cpu_supports("avx2") ? __UBlock_find_avx2 : __UBlock_find_sse2;
+#else
+        list->find_key = __UBlock_find_scalar;
+#endif
+    }
+
+    /* ================================= */
+
+    return list;
+}
+
+/* ================================================================ */
+
+void UList_print(const UList_t list, print_fptr print) {
+    /* =========== VARIABLES ========== */
+
+    /* Alternative print function */
+    print_fptr alt_print = NULL;
+
+    /* Block we are using to traverse the list */
+    UBlock_t block = NULL;
+
+    /* Number of elements printed so far */
+    size_t printed = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ============= Make sure there is a function to use ============= */
+        if ((list->print == NULL) && (print == NULL)) {
+            LIST_WARN(__func__, "there is no associated `print` function with the given list");
+
+            return ;
+        }
+
+        /* ================================= */
+
+        printf("[");
+
+        /* Use alternative print function if provided */
+        alt_print = (print != NULL) ? print : list->print;
+
+        for (block = list->head; block != NULL; block = block->next) {
+
+            for (size_t i = 0; i < block->count; i++) {
+
+                /* Print the element data */
+                alt_print(block->slots[i]);
+
+                if (++printed < list->size) {
+                    printf(", ");
+                }
+            }
+        }
+
+        printf("]\n");
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================= */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int UList_insert_first(const UList_t list, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    /* Block that receives the element */
+    UBlock_t block = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* Keys are read from the data, so keyed lists cannot hold NULL */
+        if (ULIST_KEYED(list) && (data == NULL)) {
+            LIST_WARN(__func__, "provided data is NULL, keyed lists need an int to read the key from");
+
+            return result;
+        }
+
+        /* Start a new head block when the current one is full */
+        if (((block = list->head) != NULL) && (block->count < ULIST_SLOTS)) {
+
+            /* Make room for the element at the front of the block */
+            memmove(&block->slots[1], &block->slots[0], block->count * sizeof(Data));
+
+            if (ULIST_KEYED(list)) {
+                memmove(&block->keys[1], &block->keys[0], block->count * sizeof(int));
+            }
+        }
+        else {
+            block = __UBlock_create(list, NULL);
+        }
+
+        /* __UBlock_create function will tell you if there is an error occured while block creation */
+        if (block != NULL) {
+
+            /* =============== Cast to avoid a warning message ================ */
+            block->slots[0] = (Data) data;
+
+            if (ULIST_KEYED(list)) {
+                block->keys[0] = *((const int*) data);
+            }
+
+            block->count++;
+
+            list->size++;
+
+            /* ================================= */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int UList_insert_last(const UList_t list, const Data data) {
+    /* =========== VARIABLES ========== */
+
+    /* Block that receives the element */
+    UBlock_t block = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* Keys are read from the data, so keyed lists cannot hold NULL */
+        if (ULIST_KEYED(list) && (data == NULL)) {
+            LIST_WARN(__func__, "provided data is NULL, keyed lists need an int to read the key from");
+
+            return result;
+        }
+
+        /* Start a new tail block when the current one is full */
+        if (((block = list->tail) == NULL) || (block->count == ULIST_SLOTS)) {
+            block = __UBlock_create(list, list->tail);
+        }
+
+        /* __UBlock_create function will tell you if there is an error occured while block creation */
+        if (block != NULL) {
+
+            /* =============== Cast to avoid a warning message ================ */
+            if (ULIST_KEYED(list)) {
+                block->keys[block->count] = *((const int*) data);
+            }
+
+            block->slots[block->count++] = (Data) data;
+
+            list->size++;
+
+            /* ================================= */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+Data UList_find(const UList_t list, const Data data, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* Block containing the element */
+    UBlock_t block = NULL;
+
+    /* Slot index of the element */
+    size_t index = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        if (data != NULL) {
+
+            /* ============= Make sure there is a function to use ============= */
+            if ((list->match == NULL) && (match == NULL)) {
+                LIST_WARN(__func__, "there is no associated `match` function with the given list");
+
+                return NULL;
+            }
+
+            /* ================================= */
+
+            /* Use alternative match function if provided */
+            if ((block = __UList_locate(list, data, (match != NULL) ? match : list->match, &index)) != NULL) {
+                return block->slots[index];
+            }
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+Data UList_find_int(const UList_t list, int key) {
+    /* =========== VARIABLES ========== */
+
+    /* Block we are using to traverse the list */
+    UBlock_t block = NULL;
+
+    /* Slot index of the element */
+    size_t index = 0;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list == NULL) {
+        LIST_WARN(__func__, "provided list is NULL");
+
+        return NULL;
+    }
+
+    /* Whole blocks are compared at once */
+    if (ULIST_KEYED(list)) {
+        return ((block = list->find_key(list->head, key, &index)) != NULL) ? block->slots[index] : NULL;
+    }
+
+    for (block = list->head; block != NULL; block = block->next) {
+
+        for (index = 0; index < block->count; index++) {
+
+            /* Slots without data hold no key */
+            if ((block->slots[index] != NULL) && (*((int*) block->slots[index]) == key)) {
+                return block->slots[index];
+            }
+        }
+    }
+
+    /* ================================= */
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int UList_remove_first(const UList_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Data to be deleted */
+    Data data = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            data = __UList_remove_at(list, list->head, 0);
+
+            /* Destroy data if needed */
+            if (list->destroy != NULL) {
+                list->destroy(data);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int UList_remove_last(const UList_t list) {
+    /* =========== VARIABLES ========== */
+
+    /* Data to be deleted */
+    Data data = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* If the list is not empty */
+        if (list->size > 0) {
+
+            data = __UList_remove_at(list, list->tail, list->tail->count - 1);
+
+            /* Destroy data if needed */
+            if (list->destroy != NULL) {
+                list->destroy(data);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int UList_remove(const UList_t list, const Data data, match_fptr match) {
+    /* =========== VARIABLES ========== */
+
+    /* Block containing the element */
+    UBlock_t block = NULL;
+
+    /* Slot index of the element */
+    size_t index = 0;
+
+    /* Data to be deleted */
+    Data old_data = NULL;
+
+    int result = -1;
+
+    /* ================================= */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if (list != NULL) {
+
+        /* ============= Make sure there is a function to use ============= */
+        if ((list->match == NULL) && (match == NULL)) {
+            LIST_WARN(__func__, "there is no associated `match` function with the given list");
+
+            return result;
+        }
+
+        /* ================================= */
+
+        if ((data != NULL) && ((block = __UList_locate(list, data, (match != NULL) ? match : list->match, &index)) != NULL)) {
+
+            old_data = __UList_remove_at(list, block, index);
+
+            /* Destroy data if needed */
+            if (list->destroy != NULL) {
+                list->destroy(old_data);
+            }
+
+            /* ================================ */
+
+            result = 0;
+        }
+    }
+    else {
+        LIST_WARN(__func__, "provided list is NULL");
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
+
+int UList_destroy(UList_t* list) {
+    /* =========== VARIABLES ========== */
+
+    /* Block that is being released */
+    UBlock_t block = NULL;
+
+    /* Operation result */
+    int result = -1;
+
+    /* ================================ */
+
+
+
+    /* ================================================================ */
+    /* ================= Make sure a list is not NULL ================= */
+    /* ================================================================ */
+
+    if ((list != NULL) && (*list != NULL)) {
+
+        /* Release whole blocks at once */
+        while ((block = (*list)->head) != NULL) {
+
+            if ((*list)->destroy != NULL) {
+                for (size_t i = 0; i < block->count; i++) {
+                    (*list)->destroy(block->slots[i]);
+                }
+            }
+
+            (*list)->head = block->next;
+
+            free(block);
+        }
+
+        /* Clear memory */
+        LIST_SCRUB(*list, sizeof(struct _unrolled_list));
+
+        /* Deallocate memory */
+        free(*list);
+
+        *list = NULL;
+
+        /* ================================ */
+
+        result = 0;
+    }
+
+    /* ================================ */
+
+    return result;
+}
+
+/* ================================================================ */
@@ -0,0 +1,249 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include "../data/data.h"
+#include "../diagnostics/diagnostics.h"
+#include "../../guard/guard.h"
+
+#define UList_size(list) ((list != NULL) ? list->size : -1)
+
+/* Number of data slots in a block, 13 slots make a block exactly two cache lines long */
+#ifndef ULIST_SLOTS
+    #define ULIST_SLOTS 13
+#endif
+
+/* Blocks start at a cache line boundary */
+#define ULIST_ALIGN 64
+
+/*
+ * Lists created with UList_create_int keep a copy of every int key next to the data pointers of a block,
+ * so UList_find_int compares a key against a whole block with vector instructions (AVX2 or SSE2, chosen
+ * at run time). Build with ULIST_NO_SIMD to compare keys one by one instead.
+*/
+
+/* ================================================================ */
+/* ======================= TYPES DEFINITIONS ====================== */
+/* ================================================================ */
+
+/**
+ * A structure that represents a block of consecutive elements of an unrolled list
+*/
+typedef struct _ublock* UBlock_t;
+
+/* ================================ */
+
+/**
+ * A data type that represents a linked sequence of blocks, each holding several elements
+*/
+typedef struct _unrolled_list* UList_t;
+
+/* ================================ */
+
+/**
+ * A function that finds the first key equal to the given one, scanning blocks from the given one on.
+ * It returns the block holding the key and stores the slot index, or returns NULL.
+*/
+typedef struct _ublock* (*ukey_fptr)(struct _ublock* block, int key, size_t* index);
+
+/* ================================ */
+
+/* ================================================================ */
+/* ====================== TYPES IMPLEMENTAION ===================== */
+/* ================================================================ */
+
+struct _ublock {
+    /* The previous block in the sequence */
+    struct _ublock* prev;
+
+    /* The next block in the sequence */
+    struct _ublock* next;
+
+    /* Number of occupied slots, they are always slots[0 .. count - 1] */
+    size_t count;
+
+    /* Pointers to data containers */
+    Data slots[ULIST_SLOTS];
+
+    /* Keys the data of the slots points to, present only in lists created with UList_create_int */
+    int keys[];
+};
+
+struct _unrolled_list {
+    /* Number of elements in the list */
+    size_t size;
+
+    /* Number of blocks in the list */
+    size_t blocks;
+
+    /* First block of the list */
+    struct _ublock* head;
+
+    /* Last block of the list */
+    struct _ublock* tail;
+
+    /* Size of a block rounded up to the cache line boundary, with room for keys if there are any */
+    size_t block_size;
+
+    /* Function comparing a key against the keys of a block, NULL if blocks have no keys */
+    ukey_fptr find_key;
+
+    /* The encapsulated destroy function passed to UList_create */
+    destroy_fptr destroy;
+
+    /* The encapsulated print function passed to UList_create */
+    print_fptr print;
+
+    /* The encapsulated match function passed to UList_create */
+    match_fptr match;
+};
+
+/* ================================================================ */
+/* ========================== UList_t API ========================= */
+/* ================================================================ */
+
+/**
+ * Allocate a new instance of an unrolled list data type.
+ *
+ * @param destroy pointer to a function that handles the deletion of data
+ * @param print pointer to a function that prints data residing in the list
+ * @param match a pointer to a function that compares data in the list
+ *
+ * @return a new instance of an unrolled list on success, NULL on failure.
+*/
+extern UList_t UList_create(destroy_fptr destroy, print_fptr print, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Allocate a new instance of an unrolled list of ints. Data inserted into the list must point to an int,
+ * which must not change while the data is in the list, and can then be found with UList_find_int.
+ * Inserting NULL data into such a list fails.
+ *
+ * @param destroy pointer to a function that handles the deletion of data
+ * @param print pointer to a function that prints data residing in the list
+ * @param match a pointer to a function that compares data in the list
+ *
+ * @return a new instance of an unrolled list on success, NULL on failure.
+*/
+extern UList_t UList_create_int(destroy_fptr destroy, print_fptr print, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Output the content of an unrolled list.
+ *
+ * @param list list to be printed out
+ * @param print alternative print function used to handle data in the list
+ *
+ * @return none.
+*/
+extern void UList_print(const UList_t list, print_fptr print);
+
+/* ================================================================ */
+
+/**
+ * Insert a new element with specified data at the beginning of the list
+ *
+ * @param list list to insert into
+ * @param data data to be inserted
+ *
+ * @return 0 on success, negative value on error.
+*/
+extern int UList_insert_first(const UList_t list, const Data data);
+
+/* ================================================================ */
+
+/**
+ * Insert a new element with specified data at the end of the list
+ *
+ * @param list list to insert into
+ * @param data data to be inserted
+ *
+ * @return 0 on success, negative value on error.
+*/
+extern int UList_insert_last(const UList_t list, const Data data);
+
+/* ================================================================ */
+
+/**
+ * Find an element in the list that matches specified data (the first occurrence).
+ *
+ * @param list list to search in
+ * @param data data to be searched
+ * @param match alternative match function used to compare data in the list
+ *
+ * @return data stored in the list on success, NULL on failure.
+*/
+extern Data UList_find(const UList_t list, const Data data, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Find an element whose data is an int equal to the key (the first occurrence). Lists created with
+ * UList_create_int compare the key against whole blocks at once, other lists compare data one by one
+ * and pass over NULL data.
+ *
+ * @param list list to search in
+ * @param key key to be searched
+ *
+ * @return data stored in the list on success, NULL on failure.
+*/
+extern Data UList_find_int(const UList_t list, int key);
+
+/* ================================================================ */
+
+/**
+ * Remove the first element from the list
+ *
+ * @param list list to remove from
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int UList_remove_first(const UList_t list);
+
+/* ================================================================ */
+
+/**
+ * Remove the last element from the list
+ *
+ * @param list list to remove from
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int UList_remove_last(const UList_t list);
+
+/* ================================================================ */
+
+/**
+ * Remove the first element that matches specified data
+ *
+ * @param list list to remove from
+ * @param data data to be searched
+ * @param match alternative match function used to compare data in the list
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int UList_remove(const UList_t list, const Data data, match_fptr match);
+
+/* ================================================================ */
+
+/**
+ * Destroy the unrolled list.
+ *
+ * @param list list to be destroyed
+ *
+ * @return 0 on success, negative value on failure.
+*/
+extern int UList_destroy(UList_t* list);
+
+/* ================================================================ */
+
+#ifdef __cplusplus
+    }
+#endif
+
+#endif
@@ -0,0 +1,232 @@
+#include "../src/list.h"
+#include "check.h"
+
+/* Number of elements in the longer lists, more than the traversal prefetches ahead */
+#define NUM 1000
+
+/* ================================================================ */
+
+/* Match ints, NULL data only matches NULL data */
+int int_match(const Data data_1, const Data data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return data_1 != data_2;
+    }
+
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, int_match);
+
+    List_t built = NULL;
+
+    Data array[2] = { NULL, NULL };
+
+    Data* copy = NULL;
+
+    int values[2] = { -1, -1 };
+
+    size_t count = 5;
+
+    /* ================================ */
+
+
+
+    CHECK(List_to_array(NULL, array, 2) == 0);
+
+    CHECK(List_to_array_alloc(list, NULL) == NULL);
+
+    CHECK(List_copy_values(NULL, values, sizeof(int), 2) == 0);
+
+    CHECK(List_from_values(free, NULL, int_match, values, 0, 2) == NULL);
+
+    CHECK(List_from_values(free, NULL, int_match, values, LIST_INLINE_SIZE + 1, 2) == NULL);
+
+    CHECK(List_from_values(free, NULL, int_match, NULL, sizeof(int), 2) == NULL);
+
+    /* ========================= Empty list =========================== */
+    CHECK(List_to_array(list, array, 2) == 0);
+
+    CHECK((array[0] == NULL) && (List_copy_values(list, values, sizeof(int), 2) == 0) && (values[0] == -1));
+
+    copy = List_to_array_alloc(list, &count);
+
+    CHECK((copy != NULL) && (count == 0));
+
+    free(copy);
+
+    built = List_from_values(free, NULL, int_match, NULL, sizeof(int), 0);
+
+    CHECK((built != NULL) && (built->size == 0) && (built->head == NULL));
+
+    List_destroy(&built);
+
+    /* ========================= One element ========================== */
+    CHECK(List_insert_last(list, new_int(1)) == 0);
+
+    CHECK((List_to_array(list, array, 2) == 1) && (array[0] == list->head->data) && (array[1] == NULL));
+
+    CHECK((List_copy_values(list, values, sizeof(int), 2) == 1) && (values[0] == 1) && (values[1] == -1));
+
+    copy = List_to_array_alloc(list, &count);
+
+    CHECK((copy != NULL) && (count == 1) && (copy[0] == list->head->data));
+
+    free(copy);
+
+    built = List_from_values(free, NULL, int_match, values, sizeof(int), 1);
+
+    CHECK((built->size == 1) && (*((int*) built->head->data) == 1) && (built->head == built->tail));
+
+    List_destroy(&built);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_long(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, int_match);
+
+    List_t built = NULL;
+
+    Data array[NUM];
+
+    Data* copy = NULL;
+
+    int values[NUM];
+
+    int again[NUM];
+
+    size_t count = 0;
+
+    size_t i = 0;
+
+    int key = 3;
+
+    /* ================================ */
+
+
+
+    /* Equal values, boxed and stored in the nodes */
+    for (int j = 0; j < NUM; j++) {
+        CHECK(((j % 2 == 0) ? List_insert_last_value(list, &key, sizeof(int)) : List_insert_last(list, new_int(j % 5))) == 0);
+    }
+
+    /* A short array takes the first elements, the size tells what is missing */
+    CHECK(List_to_array(list, array, NUM / 2) == NUM);
+
+    CHECK(List_copy_values(list, values, sizeof(int), NUM / 2) == NUM);
+
+    i = 0;
+
+    for (Node_t node = list->head; i < NUM / 2; node = node->next, i++) {
+        CHECK((array[i] == node->data) && (values[i] == *((int*) node->data)));
+    }
+
+    /* The whole list, then back into a list of values */
+    CHECK(List_copy_values(list, values, sizeof(int), NUM) == NUM);
+
+    copy = List_to_array_alloc(list, &count);
+
+    CHECK((copy != NULL) && (count == NUM));
+
+    built = List_from_values(NULL, NULL, int_match, values, sizeof(int), NUM);
+
+    CHECK((built != NULL) && (built->size == NUM) && (built->pool != NULL));
+
+    CHECK(List_copy_values(built, again, sizeof(int), NUM) == NUM);
+
+    i = 0;
+
+    for (Node_t node = list->head; node != NULL; node = node->next, i++) {
+        CHECK((copy[i] == node->data) && (again[i] == values[i]) && (values[i] == *((int*) node->data)));
+    }
+
+    /* The one closest to the head is found in the copy too */
+    CHECK(List_find(built, &key, NULL) == built->head);
+
+    free(copy);
+
+    List_destroy(&built);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, int_match);
+
+    Data array[3];
+
+    int values[3] = { -1, -1, -1 };
+
+    /* ================================ */
+
+
+
+    CHECK(List_insert_last(list, NULL) == 0);
+
+    CHECK(List_insert_last(list, new_int(7)) == 0);
+
+    CHECK(List_insert_last(list, NULL) == 0);
+
+    /* Pointers are copied as they are */
+    CHECK(List_to_array(list, array, 3) == 3);
+
+    CHECK((array[0] == NULL) && (array[1] == list->head->next->data) && (array[2] == NULL));
+
+    /* NULL data gives values of zero bytes */
+    CHECK(List_copy_values(list, values, sizeof(int), 3) == 3);
+
+    CHECK((values[0] == 0) && (values[1] == 7) && (values[2] == 0));
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_long();
+
+    test_null_data();
+
+    /* ================================ */
+
+    return CHECK_RESULT("array");
+}
+
+/* ================================================================ */
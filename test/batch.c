@@ -0,0 +1,276 @@
+#include "items.h"
+
+/* Number of elements in the longer arrays */
+#define NUM 100
+
+/* ================================================================ */
+
+/**
+ * Fill the array with new items of the same key and ids base, base + 1, ...
+*/
+static void fill(Data* data, int base, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        data[i] = new_item(0, base + (int) i);
+    }
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, item_match);
+
+    List_t built = NULL;
+
+    Data data[1];
+
+    const int one[] = { 1 };
+
+    const int two[] = { 1, 2 };
+
+    /* ================================ */
+
+
+
+    /* ===================== Nothing to insert ======================== */
+    CHECK(List_insert_first_n(list, NULL, 0) == 0);
+
+    CHECK(List_insert_last_n(list, data, 0) == 0);
+
+    CHECK(List_insert_last_n(list, NULL, 1) != 0);
+
+    CHECK(List_insert_first_n(NULL, data, 0) != 0);
+
+    CHECK(check_list(list) == 0);
+
+    built = List_from_array(free, NULL, item_match, NULL, 0);
+
+    CHECK((built != NULL) && (check_list(built) == 0));
+
+    /* An empty list built from an array goes on working */
+    CHECK(List_insert_last(built, new_item(0, 0)) == 0);
+
+    CHECK(check_list(built) == 1);
+
+    List_destroy(&built);
+
+    CHECK(List_from_array(free, NULL, item_match, NULL, 1) == NULL);
+
+    /* ========================= One element ========================== */
+    fill(data, 1, 1);
+
+    CHECK(List_insert_first_n(list, data, 1) == 0);
+
+    check_ids(list, one, 1);
+
+    CHECK(list->head == list->tail);
+
+    fill(data, 2, 1);
+
+    CHECK(List_insert_last_n(list, data, 1) == 0);
+
+    check_ids(list, two, 2);
+
+    fill(data, 1, 1);
+
+    built = List_from_array(free, NULL, item_match, data, 1);
+
+    check_ids(built, one, 1);
+
+    CHECK(check_list(built) == 1);
+
+    List_destroy(&built);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_order(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = make(0, 0, NUM, NUM);
+
+    List_t built = NULL;
+
+    Data data[NUM];
+
+    int ids[3 * NUM];
+
+    /* ================================ */
+
+
+
+    CHECK(List_index(list, item_hash, 0) == 0);
+
+    CHECK(List_skip(list, item_order) == 0);
+
+    /* Arrays keep their order before and after what is in the list */
+    fill(data, 0, NUM);
+
+    CHECK(List_insert_first_n(list, data, NUM) == 0);
+
+    fill(data, 2 * NUM, NUM);
+
+    CHECK(List_insert_last_n(list, data, NUM) == 0);
+
+    for (int i = 0; i < 3 * NUM; i++) {
+        ids[i] = i;
+    }
+
+    check_ids(list, ids, 3 * NUM);
+
+    /* The index and the skip levels know every new node */
+    CHECK(check_list(list) == 3 * NUM);
+
+    /* A list built from an array takes more nodes than its pool was made for */
+    fill(data, 0, NUM);
+
+    built = List_from_array(free, NULL, item_match, data, NUM);
+
+    CHECK((built != NULL) && (built->pool != NULL));
+
+    fill(data, NUM, NUM);
+
+    CHECK(List_insert_last_n(built, data, NUM) == 0);
+
+    CHECK(List_insert_last(built, new_item(0, 2 * NUM)) == 0);
+
+    check_ids(built, ids, 2 * NUM + 1);
+
+    List_destroy(&built);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = make(0, 0, 0, 2);
+
+    struct item key = { 0, 1 };
+
+    Data data[4];
+
+    const int ids[] = { 1, 7, 1, 0, 1, 1, 7 };
+
+    /* ================================ */
+
+
+
+    CHECK(List_index(list, item_hash, 0) == 0);
+
+    data[0] = new_item(0, 1);
+
+    data[1] = new_item(0, 7);
+
+    data[2] = new_item(0, 1);
+
+    CHECK(List_insert_first_n(list, data, 3) == 0);
+
+    data[0] = new_item(0, 1);
+
+    data[1] = new_item(0, 7);
+
+    CHECK(List_insert_last_n(list, data, 2) == 0);
+
+    check_ids(list, ids, 7);
+
+    /* Every copy is indexed, the one closest to the head is found */
+    CHECK(Index_find(list->index, &key, item_match, NULL, 0) == 4);
+
+    CHECK(List_find(list, &key, NULL) == list->head);
+
+    key.id = 7;
+
+    CHECK(List_find(list, &key, NULL) == list->head->next);
+
+    CHECK(List_remove_first(list) == 0);
+
+    CHECK(List_remove_first(list) == 0);
+
+    CHECK(List_find(list, &key, NULL) == list->tail);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, NULL);
+
+    List_t built = NULL;
+
+    Data data[3] = { NULL, NULL, NULL };
+
+    size_t i = 0;
+
+    /* ================================ */
+
+
+
+    /* NULL entries of the array become nodes with NULL data */
+    data[1] = new_item(0, 1);
+
+    CHECK(List_insert_last_n(list, data, 3) == 0);
+
+    data[1] = new_item(0, 2);
+
+    CHECK(List_insert_first_n(list, data, 3) == 0);
+
+    CHECK(check_list(list) == 6);
+
+    for (Node_t node = list->head; node != NULL; node = node->next, i++) {
+        CHECK((i % 3 == 1) ? ((node->data != NULL) && (((struct item*) node->data)->id == (i < 3 ? 2 : 1))) : (node->data == NULL));
+    }
+
+    data[1] = NULL;
+
+    built = List_from_array(free, NULL, NULL, data, 3);
+
+    CHECK((check_list(built) == 3) && (built->head->data == NULL) && (built->tail->data == NULL));
+
+    List_destroy(&built);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_order();
+
+    test_duplicates();
+
+    test_null_data();
+
+    /* ================================ */
+
+    return CHECK_RESULT("batch");
+}
+
+/* ================================================================ */
@@ -0,0 +1,43 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Minimal support for the correctness tests (test/<name>.c, built as test_<name>.out by `make check`).
+ * A failed check is reported and counted, the test goes on so one run shows every broken property.
+ * Checks may fail in several threads at once.
+*/
+
+/* Number of failed checks of the test program */
+static int check_failures = 0;
+
+/* ================================================================ */
+
+/**
+ * Check that the condition holds, reporting the place and the condition if it does not.
+*/
+#define CHECK(condition)                                                                                \
+    do {                                                                                                \
+        if (!(condition)) {                                                                             \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);               \
+                                                                                                        \
+            __atomic_fetch_add(&check_failures, 1, __ATOMIC_RELAXED);                                   \
+        }                                                                                               \
+    } while (0)
+
+/* ================================================================ */
+
+/**
+ * Report the result of the test program and turn it into its exit status.
+ *
+ * @param name name of the test program
+*/
+#define CHECK_RESULT(name)                                                                              \
+    ((check_failures == 0) ? (printf("%s: ok\n", (name)), EXIT_SUCCESS)                                 \
+                           : (printf("%s: %d checks failed\n", (name), check_failures), EXIT_FAILURE))
+
+/* ================================================================ */
+
+#endif
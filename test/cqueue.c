@@ -0,0 +1,154 @@
+#include "../src/cqueue/cqueue.h"
+#include "check.h"
+
+#include <pthread.h>
+#include <stdint.h>
+
+/* Number of producer threads, and of consumer threads */
+#define THREADS 4
+
+/* Number of elements every producer enqueues, enough for every consumer to reclaim nodes many times */
+#define NUM 100000
+
+/* ================================================================ */
+
+static CQueue_t queue = NULL;
+
+/* Number of elements dequeued by all consumers */
+static atomic_size_t dequeued;
+
+/* How many times every element was dequeued, elements are 1 .. THREADS * NUM */
+static atomic_uchar seen[THREADS * NUM + 1];
+
+/* Last element every consumer got from every producer, elements of a producer must come in order */
+static size_t last[THREADS][THREADS];
+
+/* ================================================================ */
+
+static void* produce(void* arg) {
+    /* Elements of the producer are base + 1 .. base + NUM */
+    size_t base = (size_t) (uintptr_t) arg * NUM;
+
+    for (size_t i = 1; i <= NUM; i++) {
+        CHECK(CQueue_enqueue(queue, (Data) (uintptr_t) (base + i)) == 0);
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+static void* consume(void* arg) {
+    size_t consumer = (size_t) (uintptr_t) arg;
+
+    size_t value = 0;
+
+    Data data = NULL;
+
+    while (atomic_load(&dequeued) < THREADS * NUM) {
+
+        if (CQueue_dequeue(queue, &data) != 0) {
+            continue ;
+        }
+
+        value = (size_t) (uintptr_t) data;
+
+        CHECK((value >= 1) && (value <= THREADS * NUM));
+
+        if ((value >= 1) && (value <= THREADS * NUM)) {
+
+            /* No element is handed out twice */
+            CHECK(atomic_fetch_add(&seen[value], 1) == 0);
+
+            /* FIFO per producer, as seen by a single consumer */
+            CHECK(value > last[consumer][(value - 1) / NUM]);
+
+            last[consumer][(value - 1) / NUM] = value;
+        }
+
+        atomic_fetch_add(&dequeued, 1);
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int main(void) {
+    /* =========== VARIABLES ========== */
+
+    pthread_t producers[THREADS];
+
+    pthread_t consumers[THREADS];
+
+    Data data = NULL;
+
+    int* x = NULL;
+
+    /* ================================ */
+
+
+
+    /* ============ Sequential FIFO order and the empty queue ========= */
+    queue = CQueue_create(NULL);
+
+    CHECK(queue != NULL);
+
+    CHECK(CQueue_dequeue(queue, &data) != 0);
+
+    for (size_t i = 1; i <= 10; i++) {
+        CQueue_enqueue(queue, (Data) (uintptr_t) i);
+    }
+
+    CHECK(CQueue_size(queue) == 10);
+
+    for (size_t i = 1; i <= 10; i++) {
+        CHECK((CQueue_dequeue(queue, &data) == 0) && ((size_t) (uintptr_t) data == i));
+    }
+
+    CHECK(CQueue_dequeue(queue, &data) != 0);
+
+    CHECK(CQueue_size(queue) == 0);
+
+    /* ====== Producers and consumers at once: no loss, no duplicates ====== */
+    atomic_init(&dequeued, 0);
+
+    for (size_t i = 0; i < THREADS; i++) {
+        pthread_create(&producers[i], NULL, produce, (void*) (uintptr_t) i);
+
+        pthread_create(&consumers[i], NULL, consume, (void*) (uintptr_t) i);
+    }
+
+    for (size_t i = 0; i < THREADS; i++) {
+        pthread_join(producers[i], NULL);
+
+        pthread_join(consumers[i], NULL);
+    }
+
+    for (size_t value = 1; value <= THREADS * NUM; value++) {
+        CHECK(atomic_load(&seen[value]) == 1);
+    }
+
+    CHECK(CQueue_size(queue) == 0);
+
+    CHECK(CQueue_dequeue(queue, &data) != 0);
+
+    CHECK(CQueue_destroy(&queue) == 0);
+
+    CHECK(queue == NULL);
+
+    /* ============= Data left in the queue is destroyed ============== */
+    queue = CQueue_create(free);
+
+    x = (int*) malloc(sizeof(int));
+
+    CHECK(CQueue_enqueue(queue, x) == 0);
+
+    CHECK(CQueue_destroy(&queue) == 0);
+
+    /* ================================ */
+
+    return CHECK_RESULT("cqueue");
+}
+
+/* ================================================================ */
@@ -0,0 +1,254 @@
+#include "items.h"
+
+/* Number of elements in the longer lists */
+#define NUM 100
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, item_match);
+
+    struct _list_cursor cursor;
+
+    const int one[] = { 1 };
+
+    const int three[] = { 0, 1, 2 };
+
+    /* ================================ */
+
+
+
+    CHECK(List_cursor_init(NULL, list) != 0);
+
+    CHECK(List_cursor_init(&cursor, NULL) != 0);
+
+    CHECK(List_cursor_next(NULL) == NULL);
+
+    /* ================ Empty list: past the end at once =============== */
+    CHECK((List_cursor_init(&cursor, list) == 0) && (cursor.node == NULL));
+
+    CHECK(List_cursor_next(&cursor) == NULL);
+
+    CHECK(List_cursor_remove(&cursor) != 0);
+
+    /* Inserting after the end appends */
+    CHECK(List_cursor_insert_after(&cursor, new_item(0, 1)) == 0);
+
+    check_ids(list, one, 1);
+
+    CHECK((check_list(list) == 1) && (cursor.node == NULL) && (cursor.prev == list->head));
+
+    /* ========================= One element ========================== */
+    CHECK(List_cursor_init(&cursor, list) == 0);
+
+    CHECK(cursor.node == list->head);
+
+    CHECK(List_cursor_insert_before(&cursor, new_item(0, 0)) == 0);
+
+    CHECK(List_cursor_insert_after(&cursor, new_item(0, 2)) == 0);
+
+    check_ids(list, three, 3);
+
+    CHECK(check_list(list) == 3);
+
+    /* The cursor stayed on its node, removing everything from there on leaves the head */
+    CHECK(((struct item*) cursor.node->data)->id == 1);
+
+    CHECK((List_cursor_remove(&cursor) == 0) && (List_cursor_remove(&cursor) == 0));
+
+    CHECK((cursor.node == NULL) && (List_cursor_remove(&cursor) != 0));
+
+    CHECK((check_list(list) == 1) && (list->tail == list->head));
+
+    /* Removing the only node empties the list */
+    CHECK(List_cursor_init(&cursor, list) == 0);
+
+    CHECK(List_cursor_remove(&cursor) == 0);
+
+    CHECK((check_list(list) == 0) && (list->tail == NULL));
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_walk(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = make(0, 1, 0, NUM);
+
+    struct _list_cursor cursor;
+
+    int ids[NUM + NUM / 2];
+
+    size_t n = 0;
+
+    /* ================================ */
+
+
+
+    CHECK(List_index(list, item_hash, 0) == 0);
+
+    CHECK(List_skip(list, item_order) == 0);
+
+    /* One pass: drop odd ids, put a new node after every fourth and before every tenth */
+    for (List_cursor_init(&cursor, list); cursor.node != NULL; ) {
+        int id = ((struct item*) cursor.node->data)->id;
+
+        if (id % 2 == 1) {
+            CHECK(List_cursor_remove(&cursor) == 0);
+
+            continue ;
+        }
+
+        if (id % 10 == 0) {
+            CHECK(List_cursor_insert_before(&cursor, new_item(0, 1000 + id)) == 0);
+
+            ids[n++] = 1000 + id;
+        }
+
+        ids[n++] = id;
+
+        if (id % 4 == 0) {
+            CHECK(List_cursor_insert_after(&cursor, new_item(0, 2000 + id)) == 0);
+
+            /* Step over the new node */
+            List_cursor_next(&cursor);
+
+            ids[n++] = 2000 + id;
+        }
+
+        List_cursor_next(&cursor);
+    }
+
+    check_ids(list, ids, n);
+
+    /* The index and the skip levels follow the edits */
+    CHECK(check_list(list) == n);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, item_match);
+
+    struct _list_cursor cursor;
+
+    struct item key = { 0, 5 };
+
+    const int ids[] = { 5, 5 };
+
+    /* ================================ */
+
+
+
+    CHECK(List_index(list, item_hash, 0) == 0);
+
+    /* Equal data appended through a cursor that stays past the end */
+    CHECK(List_cursor_init(&cursor, list) == 0);
+
+    for (int i = 0; i < 3; i++) {
+        CHECK(List_cursor_insert_before(&cursor, new_item(0, 5)) == 0);
+    }
+
+    CHECK(Index_find(list->index, &key, item_match, NULL, 0) == 3);
+
+    /* Removing the first copy leaves the others, the next one is found */
+    CHECK(List_cursor_init(&cursor, list) == 0);
+
+    CHECK(List_cursor_remove(&cursor) == 0);
+
+    CHECK(List_find(list, &key, NULL) == list->head);
+
+    CHECK(Index_find(list->index, &key, item_match, NULL, 0) == 2);
+
+    check_ids(list, ids, 2);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, NULL);
+
+    struct _list_cursor cursor;
+
+    size_t count = 0;
+
+    /* ================================ */
+
+
+
+    /* Nodes with NULL data are inserted, walked over and removed like any other */
+    CHECK(List_cursor_init(&cursor, list) == 0);
+
+    CHECK(List_cursor_insert_after(&cursor, NULL) == 0);
+
+    CHECK(List_cursor_insert_before(&cursor, new_item(0, 1)) == 0);
+
+    CHECK(List_cursor_init(&cursor, list) == 0);
+
+    CHECK(List_cursor_insert_after(&cursor, NULL) == 0);
+
+    CHECK(check_list(list) == 3);
+
+    for (List_cursor_init(&cursor, list); cursor.node != NULL; List_cursor_next(&cursor)) {
+        count += (cursor.node->data == NULL);
+    }
+
+    CHECK(count == 2);
+
+    CHECK((List_cursor_init(&cursor, list) == 0) && (cursor.node->data == NULL));
+
+    CHECK((List_cursor_remove(&cursor) == 0) && (cursor.node->data == NULL));
+
+    CHECK((List_cursor_remove(&cursor) == 0) && (((struct item*) cursor.node->data)->id == 1));
+
+    CHECK((List_cursor_remove(&cursor) == 0) && (check_list(list) == 0));
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_walk();
+
+    test_duplicates();
+
+    test_null_data();
+
+    /* ================================ */
+
+    return CHECK_RESULT("cursor");
+}
+
+/* ================================================================ */
@@ -0,0 +1,329 @@
+#include "../src/dlist/dlist.h"
+#include "check.h"
+
+/* Number of elements in the longer lists */
+#define NUM 100
+
+/* ================================================================ */
+
+/* Match ints, NULL data only matches NULL data */
+int int_match(const Data data_1, const Data data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return data_1 != data_2;
+    }
+
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that both directions of the list agree with each other, with its size and with its ends.
+ *
+ * @return number of nodes in the list.
+*/
+static size_t check_links(const DList_t list) {
+    /* =========== VARIABLES ========== */
+
+    DNode_t node = NULL;
+
+    DNode_t last = NULL;
+
+    size_t count = 0;
+
+    /* ================================ */
+
+
+
+    for (node = list->head; node != NULL; last = node, node = node->next, count++) {
+        CHECK(node->prev == last);
+    }
+
+    CHECK((count == list->size) && (list->tail == last));
+
+    for (node = list->tail; node != NULL; node = node->prev) {
+        count--;
+    }
+
+    CHECK(count == 0);
+
+    /* ================================ */
+
+    return list->size;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that the list holds the values in this order, -1 stands for NULL data.
+*/
+static void check_values(const DList_t list, const int* values, size_t n) {
+    size_t i = 0;
+
+    for (DNode_t node = list->head; (node != NULL) && (i < n); node = node->next, i++) {
+        CHECK((values[i] < 0) ? (node->data == NULL) : ((node->data != NULL) && (*((int*) node->data) == values[i])));
+    }
+
+    CHECK((i == n) && (check_links(list) == n));
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    DList_t list = DList_create(free, NULL, int_match);
+
+    int key = 1;
+
+    const int one[] = { 1 };
+
+    const int two[] = { 0, 1 };
+
+    /* ================================ */
+
+
+
+    /* ========================= Empty list =========================== */
+    CHECK(check_links(list) == 0);
+
+    CHECK(DList_find(list, &key, NULL) == NULL);
+
+    CHECK(DList_remove_first(list) != 0);
+
+    CHECK(DList_remove_last(list) != 0);
+
+    CHECK(DList_remove_node(list, NULL) != 0);
+
+    /* No node given: insert at the end, or at the beginning */
+    CHECK(DList_insert_after(list, new_int(1), NULL) == 0);
+
+    check_values(list, one, 1);
+
+    CHECK(DList_insert_before(list, new_int(0), NULL) == 0);
+
+    check_values(list, two, 2);
+
+    CHECK(DList_remove_first(list) == 0);
+
+    /* ========================= One element ========================== */
+    check_values(list, one, 1);
+
+    CHECK((list->head == list->tail) && (DList_find(list, &key, NULL) == list->head));
+
+    CHECK(DList_remove_last(list) == 0);
+
+    CHECK((check_links(list) == 0) && (list->head == NULL));
+
+    CHECK(DList_insert_last(list, new_int(1)) == 0);
+
+    CHECK(DList_remove_node(list, list->head) == 0);
+
+    CHECK((check_links(list) == 0) && (list->tail == NULL));
+
+    /* ===== The emptied list goes on working ========================= */
+    CHECK(DList_insert_first(list, new_int(1)) == 0);
+
+    check_values(list, one, 1);
+
+    CHECK(DList_destroy(&list) == 0);
+
+    CHECK(list == NULL);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(void) {
+    /* =========== VARIABLES ========== */
+
+    DList_t list = DList_create(free, NULL, int_match);
+
+    DNode_t node = NULL;
+
+    int key = 3;
+
+    const int rest[] = { 3, 1, 3 };
+
+    /* ================================ */
+
+
+
+    for (int i = 0; i < 4; i++) {
+        CHECK(DList_insert_last(list, new_int(i % 2 == 0 ? 3 : 1)) == 0);
+    }
+
+    /* The one closest to the head is found */
+    node = DList_find(list, &key, NULL);
+
+    CHECK(node == list->head);
+
+    /* Removing it in the middle of the list keeps both directions linked */
+    CHECK(DList_remove_node(list, node) == 0);
+
+    node = DList_find(list, &key, NULL);
+
+    CHECK(node == list->head->next);
+
+    CHECK(DList_insert_before(list, new_int(3), list->head) == 0);
+
+    CHECK(DList_remove_node(list, list->tail) == 0);
+
+    check_values(list, rest, 3);
+
+    CHECK(DList_destroy(&list) == 0);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    DList_t list = DList_create(free, NULL, int_match);
+
+    int key = 2;
+
+    const int values[] = { -1, 2, -1, 2 };
+
+    const int rest[] = { 2, -1 };
+
+    /* ================================ */
+
+
+
+    CHECK(DList_insert_last(list, NULL) == 0);
+
+    CHECK(DList_insert_last(list, new_int(2)) == 0);
+
+    CHECK(DList_insert_after(list, NULL, list->head->next) == 0);
+
+    CHECK(DList_insert_before(list, new_int(2), NULL) == 0);
+
+    CHECK(DList_insert_after(list, new_int(2), list->tail) == 0);
+
+    CHECK(DList_remove_first(list) == 0);
+
+    check_values(list, values, 4);
+
+    /* NULL data is never searched, data around it is found */
+    CHECK(DList_find(list, NULL, NULL) == NULL);
+
+    CHECK(DList_find(list, &key, NULL) == list->head->next);
+
+    /* Nodes with NULL data are removed like any other */
+    CHECK(DList_remove_first(list) == 0);
+
+    CHECK(DList_remove_node(list, list->head->next) == 0);
+
+    CHECK(DList_remove_first(list) == 0);
+
+    CHECK(DList_insert_last(list, NULL) == 0);
+
+    check_values(list, rest, 2);
+
+    CHECK(DList_destroy(&list) == 0);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_merge(void) {
+    /* =========== VARIABLES ========== */
+
+    Pool_t pool = Pool_create(sizeof(struct _dnode), 0);
+
+    DList_t a = DList_create_pooled(free, NULL, int_match, pool);
+
+    DList_t b = DList_create_pooled(free, NULL, int_match, pool);
+
+    DList_t c = DList_create(free, NULL, int_match);
+
+    DList_t empty = DList_create(free, NULL, int_match);
+
+    int values[3 * NUM];
+
+    /* ================================ */
+
+
+
+    for (int i = 0; i < NUM; i++) {
+        DList_insert_last(a, new_int(i));
+
+        DList_insert_last(b, new_int(NUM + i));
+
+        DList_insert_last(c, new_int(2 * NUM + i));
+    }
+
+    for (int i = 0; i < 3 * NUM; i++) {
+        values[i] = i;
+    }
+
+    /* A list is not merged into itself */
+    CHECK(DList_merge(&a, &a) != 0);
+
+    CHECK(check_links(a) == NUM);
+
+    /* Nodes of one pool are relinked, others are moved into new nodes */
+    CHECK((DList_merge(&a, &b) == 0) && (b == NULL));
+
+    CHECK((DList_merge(&a, &c) == 0) && (c == NULL));
+
+    check_values(a, values, 3 * NUM);
+
+    /* Merging an empty list changes nothing, merging into one moves everything */
+    CHECK((DList_merge(&a, &empty) == 0) && (empty == NULL));
+
+    check_values(a, values, 3 * NUM);
+
+    empty = DList_create_pooled(free, NULL, int_match, pool);
+
+    CHECK((DList_merge(&empty, &a) == 0) && (a == NULL));
+
+    check_values(empty, values, 3 * NUM);
+
+    CHECK(DList_destroy(&empty) == 0);
+
+    CHECK(Pool_destroy(&pool) == 0);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_duplicates();
+
+    test_null_data();
+
+    test_merge();
+
+    /* ================================ */
+
+    return CHECK_RESULT("dlist");
+}
+
+/* ================================================================ */
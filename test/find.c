@@ -0,0 +1,171 @@
+#include "../src/list.h"
+#include "check.h"
+
+#include <string.h>
+
+/* Number of elements in the longer lists */
+#define NUM 100
+
+/* ================================================================ */
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+static char* new_str(const char* value) {
+    char* s = (char*) malloc(strlen(value) + 1);
+
+    strcpy(s, value);
+
+    return s;
+}
+
+/* ================================================================ */
+
+static void test_find_int(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, NULL);
+
+    Node_t node = NULL;
+
+    /* ================================ */
+
+
+
+    /* ========================= Empty list =========================== */
+    CHECK(List_find_int(list, 0) == NULL);
+
+    CHECK(List_find_int(NULL, 0) == NULL);
+
+    /* ========================= One element ========================== */
+    CHECK(List_insert_last(list, new_int(7)) == 0);
+
+    CHECK(List_find_int(list, 7) == list->head);
+
+    CHECK(List_find_int(list, 8) == NULL);
+
+    /* ========= Duplicates: the one closest to the head is found ===== */
+    for (int i = 0; i < NUM; i++) {
+        CHECK(List_insert_last(list, new_int(i % 10)) == 0);
+    }
+
+    node = List_find_int(list, 7);
+
+    CHECK(node == list->head);
+
+    CHECK(List_remove_first(list) == 0);
+
+    node = List_find_int(list, 7);
+
+    CHECK((node != NULL) && (*((int*) node->data) == 7) && (node == List_at(list, 7)));
+
+    CHECK(List_find_int(list, 9) == List_at(list, 9));
+
+    CHECK(List_find_int(list, 10) == NULL);
+
+    /* ============ Nodes with NULL data are passed over ============== */
+    CHECK(List_insert_first(list, NULL) == 0);
+
+    CHECK(List_insert_last(list, NULL) == 0);
+
+    CHECK(List_find_int(list, 0) == list->head->next);
+
+    CHECK(List_find_int(list, 10) == NULL);
+
+    CHECK(List_insert_last(list, new_int(10)) == 0);
+
+    CHECK(List_find_int(list, 10) == list->tail);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_find_str(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, NULL);
+
+    Node_t node = NULL;
+
+    /* ================================ */
+
+
+
+    /* ========================= Empty list =========================== */
+    CHECK(List_find_str(list, "a") == NULL);
+
+    CHECK(List_find_str(list, NULL) == NULL);
+
+    CHECK(List_find_str(NULL, "a") == NULL);
+
+    /* ========================= One element ========================== */
+    CHECK(List_insert_last(list, new_str("alpha")) == 0);
+
+    CHECK(List_find_str(list, "alpha") == list->head);
+
+    /* The first character matches, the rest does not */
+    CHECK(List_find_str(list, "alps") == NULL);
+
+    CHECK(List_find_str(list, "") == NULL);
+
+    /* ========= Duplicates: the one closest to the head is found ===== */
+    CHECK(List_insert_last(list, new_str("beta")) == 0);
+
+    CHECK(List_insert_last(list, new_str("alpha")) == 0);
+
+    CHECK(List_insert_last(list, new_str("")) == 0);
+
+    CHECK(List_find_str(list, "alpha") == list->head);
+
+    CHECK(List_remove_first(list) == 0);
+
+    node = List_find_str(list, "alpha");
+
+    CHECK((node != NULL) && (node == list->head->next));
+
+    CHECK(List_find_str(list, "") == list->tail);
+
+    /* ============ Nodes with NULL data are passed over ============== */
+    CHECK(List_insert_first(list, NULL) == 0);
+
+    CHECK(List_insert_after(list, NULL, list->head->next) == 0);
+
+    CHECK(List_find_str(list, "beta") == list->head->next);
+
+    CHECK(List_find_str(list, "alpha") == list->head->next->next->next);
+
+    CHECK(List_find_str(list, "gamma") == NULL);
+
+    CHECK(List_find_str(list, NULL) == NULL);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_find_int();
+
+    test_find_str();
+
+    /* ================================ */
+
+    return CHECK_RESULT("find");
+}
+
+/* ================================================================ */
@@ -0,0 +1,314 @@
+#include "../src/ilist/ilist.h"
+#include "check.h"
+
+/* Number of elements in the longer lists */
+#define NUM 100
+
+/* ================================================================ */
+
+/* An element that embeds its link, away from the start so the offset matters */
+struct elem {
+    int value;
+
+    struct _ilink link;
+};
+
+/* Number of elements handed over to the destroy function */
+static size_t destroyed = 0;
+
+static void elem_destroy(void* element) {
+    destroyed++;
+
+    free(element);
+}
+
+int elem_match(const Data data_1, const Data data_2) {
+    return ((struct elem*) data_1)->value - ((struct elem*) data_2)->value;
+}
+
+static struct elem* new_elem(int value) {
+    struct elem* e = (struct elem*) calloc(1, sizeof(struct elem));
+
+    e->value = value;
+
+    return e;
+}
+
+static IList_t new_list(void) {
+    return IList_create(offsetof(struct elem, link), elem_destroy, NULL, elem_match);
+}
+
+/* ================================================================ */
+
+/**
+ * Check that the list holds the values in this order, and that its size and tail agree with its links.
+*/
+static void check_values(const IList_t list, const int* values, size_t n) {
+    /* =========== VARIABLES ========== */
+
+    ILink_t link = NULL;
+
+    ILink_t last = NULL;
+
+    size_t i = 0;
+
+    /* ================================ */
+
+
+
+    for (link = list->head; link != NULL; last = link, link = link->next, i++) {
+
+        if (i < n) {
+            CHECK(IList_entry(link, struct elem, link)->value == values[i]);
+        }
+    }
+
+    CHECK((i == n) && (list->size == n) && (list->tail == last));
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    IList_t list = new_list();
+
+    struct elem key = { 1, { NULL } };
+
+    struct elem* e = new_elem(1);
+
+    const int one[] = { 1 };
+
+    /* ================================ */
+
+
+
+    destroyed = 0;
+
+    /* ========================= Empty list =========================== */
+    check_values(list, NULL, 0);
+
+    CHECK(IList_find(list, &key, NULL) == NULL);
+
+    CHECK(IList_remove_first(list) != 0);
+
+    CHECK(IList_remove_last(list) != 0);
+
+    CHECK(IList_remove(list, e) != 0);
+
+    CHECK(destroyed == 0);
+
+    /* ========================= One element ========================== */
+    CHECK(IList_insert_last(list, e) == 0);
+
+    check_values(list, one, 1);
+
+    CHECK((list->head == list->tail) && (IList_find(list, &key, NULL) == e));
+
+    CHECK(IList_remove_last(list) == 0);
+
+    check_values(list, NULL, 0);
+
+    CHECK((list->head == NULL) && (destroyed == 1));
+
+    /* ===== The emptied list goes on working ========================= */
+    CHECK(IList_insert_first(list, new_elem(1)) == 0);
+
+    check_values(list, one, 1);
+
+    CHECK(IList_remove_first(list) == 0);
+
+    CHECK((list->tail == NULL) && (destroyed == 2));
+
+    CHECK(IList_destroy(&list) == 0);
+
+    CHECK(list == NULL);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(void) {
+    /* =========== VARIABLES ========== */
+
+    IList_t list = new_list();
+
+    struct elem key = { 3, { NULL } };
+
+    struct elem* found = NULL;
+
+    const int rest[] = { 1, 3, 1 };
+
+    /* ================================ */
+
+
+
+    for (int i = 0; i < 4; i++) {
+        CHECK(IList_insert_last(list, new_elem(i % 2 == 0 ? 3 : 1)) == 0);
+    }
+
+    /* The one closest to the head is found */
+    found = (struct elem*) IList_find(list, &key, NULL);
+
+    CHECK(&found->link == list->head);
+
+    /* Elements are removed by identity, not by value */
+    CHECK(IList_remove(list, IList_entry(list->head->next->next, struct elem, link)) == 0);
+
+    CHECK(IList_find(list, &key, NULL) == found);
+
+    CHECK(IList_remove(list, found) == 0);
+
+    CHECK(IList_insert_last(list, new_elem(3)) == 0);
+
+    CHECK(IList_insert_last(list, new_elem(1)) == 0);
+
+    CHECK(IList_remove_first(list) == 0);
+
+    found = (struct elem*) IList_find(list, &key, NULL);
+
+    CHECK(&found->link == list->head->next);
+
+    check_values(list, rest, 3);
+
+    CHECK(IList_destroy(&list) == 0);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    IList_t list = new_list();
+
+    IList_t other = IList_create(offsetof(struct elem, link), NULL, NULL, elem_match);
+
+    struct elem* e = new_elem(2);
+
+    const int values[] = { 2 };
+
+    /* ================================ */
+
+
+
+    destroyed = 0;
+
+    /* There is no element without memory to link it */
+    CHECK(IList_insert_first(list, NULL) != 0);
+
+    CHECK(IList_insert_last(list, NULL) != 0);
+
+    CHECK(IList_remove(list, NULL) != 0);
+
+    /* NULL is never searched */
+    CHECK(IList_insert_last(list, e) == 0);
+
+    CHECK(IList_find(list, NULL, NULL) == NULL);
+
+    check_values(list, values, 1);
+
+    /* An element of another list is not removed, nor destroyed */
+    CHECK(IList_insert_last(other, new_elem(2)) == 0);
+
+    CHECK(IList_remove(list, IList_entry(other->head, struct elem, link)) != 0);
+
+    CHECK((destroyed == 0) && (other->size == 1));
+
+    /* Lists without a destroy function leave elements to the caller, their links can be reused */
+    e = IList_entry(other->head, struct elem, link);
+
+    CHECK(IList_remove_first(other) == 0);
+
+    CHECK((destroyed == 0) && (e->link.next == NULL));
+
+    CHECK(IList_insert_first(list, e) == 0);
+
+    CHECK(list->size == 2);
+
+    CHECK(IList_destroy(&other) == 0);
+
+    CHECK(IList_destroy(&list) == 0);
+
+    CHECK(destroyed == 2);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_many(void) {
+    /* =========== VARIABLES ========== */
+
+    IList_t list = new_list();
+
+    struct elem key = { 0, { NULL } };
+
+    int values[NUM / 2];
+
+    /* ================================ */
+
+
+
+    destroyed = 0;
+
+    for (int i = 0; i < NUM; i++) {
+        CHECK(IList_insert_last(list, new_elem(i)) == 0);
+    }
+
+    /* Odd values from the middle, then both ends */
+    for (int i = 1; i < NUM; i += 2) {
+        key.value = i;
+
+        CHECK(IList_remove(list, IList_find(list, &key, NULL)) == 0);
+    }
+
+    CHECK(IList_remove_first(list) == 0);
+
+    CHECK(IList_remove_last(list) == 0);
+
+    for (int i = 0; i < NUM / 2 - 2; i++) {
+        values[i] = 2 * (i + 1);
+    }
+
+    check_values(list, values, NUM / 2 - 2);
+
+    CHECK(IList_destroy(&list) == 0);
+
+    CHECK(destroyed == NUM);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_duplicates();
+
+    test_null_data();
+
+    test_many();
+
+    /* ================================ */
+
+    return CHECK_RESULT("ilist");
+}
+
+/* ================================================================ */
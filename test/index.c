@@ -0,0 +1,249 @@
+#include "../src/list.h"
+#include "check.h"
+
+/* Number of elements, far more than the initial buckets */
+#define NUM 2000
+
+/* Number of equal elements, more than an indexed lookup resolves without comparing data */
+#define DUPLICATES 20
+
+/* ================================================================ */
+
+/* Match ints, NULL data only matches NULL data */
+int int_match(const Data data_1, const Data data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return data_1 != data_2;
+    }
+
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+/* The same comparison through another function, so lookups walk the list instead of the index */
+int int_walk(const Data data_1, const Data data_2) {
+    return int_match(data_1, data_2);
+}
+
+size_t int_hash(const Data data) {
+    return (data != NULL) ? (size_t) *((int*) data) * 2654435761u : 0;
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that the index holds every node of the list under its data, and nothing else.
+*/
+static void check_index(const List_t list) {
+    void* items[4 * DUPLICATES];
+
+    size_t count = 0;
+
+    size_t seen = 0;
+
+    for (Node_t node = list->head; node != NULL; node = node->next) {
+        count = Index_find(list->index, node->data, int_match, items, 4 * DUPLICATES);
+
+        CHECK((count >= 1) && (count <= 4 * DUPLICATES));
+
+        /* The node is there once among the nodes equal to it */
+        seen = 0;
+
+        for (size_t i = 0; (i < count) && (i < 4 * DUPLICATES); i++) {
+            seen += (items[i] == node);
+        }
+
+        CHECK(seen == 1);
+    }
+
+    CHECK(list->index->size == list->size);
+}
+
+/* ================================================================ */
+
+/**
+ * Check that the indexed lookup finds the same node as a walk from the head.
+*/
+static void check_find(const List_t list, int value) {
+    int key = value;
+
+    CHECK(List_find(list, &key, NULL) == List_find(list, &key, int_walk));
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, int_match);
+
+    List_t unmatched = List_create(free, NULL, NULL);
+
+    int key = 1;
+
+    /* ================================ */
+
+
+
+    /* An index needs the match function it answers for */
+    CHECK(List_index(unmatched, int_hash, 0) != 0);
+
+    CHECK(unmatched->index == NULL);
+
+    /* ========================= Empty list =========================== */
+    CHECK(List_index(list, int_hash, 0) == 0);
+
+    CHECK(List_find(list, &key, NULL) == NULL);
+
+    check_index(list);
+
+    /* ========================= One element ========================== */
+    CHECK(List_insert_last(list, new_int(1)) == 0);
+
+    CHECK(List_find(list, &key, NULL) == list->head);
+
+    check_index(list);
+
+    CHECK(List_remove_first(list) == 0);
+
+    CHECK(List_find(list, &key, NULL) == NULL);
+
+    CHECK(list->index->size == 0);
+
+    /* ============ NULL data is indexed like any other =============== */
+    CHECK(List_insert_last(list, NULL) == 0);
+
+    CHECK(List_insert_last(list, new_int(1)) == 0);
+
+    CHECK(List_insert_last(list, NULL) == 0);
+
+    check_index(list);
+
+    CHECK(Index_find(list->index, NULL, int_match, NULL, 0) == 2);
+
+    /* Lookups of NULL data find nothing, with the index or without */
+    CHECK(List_find(list, NULL, NULL) == NULL);
+
+    CHECK(List_find(list, &key, NULL) == list->head->next);
+
+    CHECK(List_remove_first(list) == 0);
+
+    CHECK(Index_find(list->index, NULL, int_match, NULL, 0) == 1);
+
+    check_index(list);
+
+    /* ============ Clearing empties the index, it goes on ============ */
+    CHECK(List_clear(list) == 0);
+
+    CHECK((list->index != NULL) && (list->index->size == 0));
+
+    CHECK(List_insert_first(list, new_int(1)) == 0);
+
+    CHECK(List_find(list, &key, NULL) == list->head);
+
+    List_destroy(&unmatched);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, int_match);
+
+    int key = 0;
+
+    /* ================================ */
+
+
+
+    CHECK(List_index(list, int_hash, 0) == 0);
+
+    /* Value 3 a few times, value 7 more often than lookups remember, spread over the list */
+    for (int i = 0; i < NUM; i++) {
+        CHECK(List_insert_last(list, new_int((i % 97 == 5) ? 7 : ((i % 401 == 9) ? 3 : i + 100))) == 0);
+    }
+
+    /* Unrelated elements in front, so the first duplicate is not the head */
+    for (int i = 0; i < DUPLICATES; i++) {
+        CHECK(List_insert_first(list, new_int(i + 100000)) == 0);
+    }
+
+    check_index(list);
+
+    key = 7;
+
+    CHECK(Index_find(list->index, &key, int_match, NULL, 0) > DUPLICATES);
+
+    /* The one closest to the head is found, whatever the number of duplicates */
+    for (int round = 0; round < 4; round++) {
+        check_find(list, 3);
+
+        check_find(list, 7);
+
+        /* Removing the first one makes the next one the first */
+        CHECK(List_remove_node(list, List_find(list, &key, NULL)) == 0);
+
+        key = 3;
+
+        CHECK(List_remove_node(list, List_find(list, &key, NULL)) == 0);
+
+        key = 7;
+    }
+
+    check_find(list, 3);
+
+    check_find(list, 7);
+
+    check_index(list);
+
+    /* ============= Every other element is still found =============== */
+    for (int i = 0; i < NUM; i += 13) {
+        check_find(list, i + 100);
+    }
+
+    check_find(list, -1);
+
+    /* ============= Dropping the index keeps lookups right ============ */
+    CHECK(List_unindex(list) == 0);
+
+    CHECK(list->index == NULL);
+
+    key = 7;
+
+    CHECK(*((int*) List_find(list, &key, NULL)->data) == 7);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_duplicates();
+
+    /* ================================ */
+
+    return CHECK_RESULT("index");
+}
+
+/* ================================================================ */
@@ -0,0 +1,287 @@
+#include "../src/list.h"
+#include "check.h"
+
+/* Number of elements in the longer lists */
+#define NUM 100
+
+/* ================================================================ */
+
+/* Number of data handed over to the destroy function, NULL data aside */
+static size_t destroyed = 0;
+
+static void int_destroy(void* data) {
+    destroyed += (data != NULL);
+
+    free(data);
+}
+
+/* Match ints, NULL data only matches NULL data */
+int int_match(const Data data_1, const Data data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return data_1 != data_2;
+    }
+
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+size_t int_hash(const Data data) {
+    return (data != NULL) ? (size_t) *((int*) data) : 0;
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that the list holds the ints in this order, -1 stands for NULL data, and that nodes holding
+ * their value point to it.
+*/
+static void check_values(const List_t list, const int* values, size_t n, int inline_values) {
+    size_t i = 0;
+
+    for (Node_t node = list->head; (node != NULL) && (i < n); node = node->next, i++) {
+        CHECK((values[i] < 0) ? (node->data == NULL) : ((node->data != NULL) && (*((int*) node->data) == values[i])));
+
+        if (inline_values && (values[i] >= 0)) {
+            CHECK(node->data == (Data) node->value);
+        }
+    }
+
+    CHECK((i == n) && (list->size == n));
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(int_destroy, NULL, int_match);
+
+    int value = 1;
+
+    char big[LIST_INLINE_SIZE + 1] = { 0 };
+
+    const int one[] = { 1 };
+
+    /* ================================ */
+
+
+
+    destroyed = 0;
+
+    /* Values that are missing or do not fit are refused */
+    CHECK(List_insert_last_value(list, NULL, sizeof(int)) != 0);
+
+    CHECK(List_insert_first_value(list, &value, 0) != 0);
+
+    CHECK(List_insert_last_value(list, big, sizeof(big)) != 0);
+
+    CHECK(List_insert_first_value(NULL, &value, sizeof(int)) != 0);
+
+    /* ========================= Empty list =========================== */
+    CHECK((list->size == 0) && (List_find(list, &value, NULL) == NULL));
+
+    /* ========================= One element ========================== */
+    CHECK(List_insert_last_value(list, &value, sizeof(int)) == 0);
+
+    /* The list holds a copy */
+    value = 2;
+
+    check_values(list, one, 1, 1);
+
+    value = 1;
+
+    CHECK(List_find(list, &value, NULL) == list->head);
+
+    /* A value that fills the whole room */
+    CHECK(List_insert_first_value(list, big, sizeof(big) - 1) == 0);
+
+    CHECK(List_remove_first(list) == 0);
+
+    CHECK(List_remove_first(list) == 0);
+
+    /* Values stored in nodes are never destroyed */
+    CHECK((list->size == 0) && (destroyed == 0));
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(int_destroy, NULL, int_match);
+
+    int value = 0;
+
+    int values[NUM];
+
+    /* ================================ */
+
+
+
+    destroyed = 0;
+
+    CHECK(List_index(list, int_hash, 0) == 0);
+
+    /* Equal values, every other one stored in the node, the others boxed */
+    for (int i = 0; i < NUM; i++) {
+        value = i % 4;
+
+        values[i] = value;
+
+        CHECK(((i % 2 == 0) ? List_insert_last_value(list, &value, sizeof(int)) : List_insert_last(list, new_int(value))) == 0);
+    }
+
+    /* The one closest to the head is found through the index, whichever way it is stored */
+    for (value = 0; value < 4; value++) {
+        CHECK(List_find(list, &value, NULL) == List_at(list, (size_t) value));
+    }
+
+    check_values(list, values, NUM, 0);
+
+    /* Only boxed data is destroyed */
+    CHECK((List_remove_first(list) == 0) && (List_remove_first(list) == 0) && (destroyed == 1));
+
+    value = 0;
+
+    CHECK(List_find(list, &value, NULL) == List_at(list, 2));
+
+    CHECK(List_clear(list) == 0);
+
+    CHECK(destroyed == NUM / 2);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(int_destroy, NULL, int_match);
+
+    int value = 3;
+
+    const int values[] = { -1, 3, -1, 3 };
+
+    /* ================================ */
+
+
+
+    destroyed = 0;
+
+    /* NULL data sits next to values stored in nodes */
+    CHECK(List_insert_last(list, NULL) == 0);
+
+    CHECK(List_insert_last_value(list, &value, sizeof(int)) == 0);
+
+    CHECK(List_insert_last(list, NULL) == 0);
+
+    CHECK(List_insert_last_value(list, &value, sizeof(int)) == 0);
+
+    check_values(list, values, 4, 1);
+
+    CHECK(List_find(list, &value, NULL) == list->head->next);
+
+    CHECK(List_find(list, NULL, NULL) == NULL);
+
+    CHECK(List_find_int(list, 3) == list->head->next);
+
+    List_destroy(&list);
+
+    CHECK(destroyed == 0);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_moves(void) {
+    /* =========== VARIABLES ========== */
+
+    Pool_t pool = Pool_create(sizeof(struct _node), 0);
+
+    List_t dest = List_create(int_destroy, NULL, int_match);
+
+    List_t src = List_create_pooled(int_destroy, NULL, int_match, pool);
+
+    int values[2 * NUM];
+
+    /* ================================ */
+
+
+
+    destroyed = 0;
+
+    for (int i = 0; i < NUM; i++) {
+        values[i] = i;
+
+        values[NUM + i] = NUM + i;
+
+        List_insert_last_value(dest, &values[i], sizeof(int));
+
+        List_insert_last_value(src, &values[NUM + i], sizeof(int));
+    }
+
+    /* Nodes of another pool are copied, values come along into the new nodes */
+    CHECK((List_merge(&dest, &src) == 0) && (src == NULL));
+
+    check_values(dest, values, 2 * NUM, 1);
+
+    /* Split off nodes keep their values */
+    src = List_split_at(dest, List_at(dest, NUM - 1));
+
+    check_values(dest, values, NUM, 1);
+
+    check_values(src, values + NUM, NUM, 1);
+
+    List_destroy(&src);
+
+    List_destroy(&dest);
+
+    Pool_destroy(&pool);
+
+    CHECK(destroyed == 0);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_duplicates();
+
+    test_null_data();
+
+    test_moves();
+
+    /* ================================ */
+
+    return CHECK_RESULT("inline");
+}
+
+/* ================================================================ */
@@ -0,0 +1,142 @@
+#ifndef ITEMS_H
+#define ITEMS_H
+
+#include "../src/list.h"
+#include "check.h"
+
+/*
+ * Elements and checks shared by the tests of operations that relink nodes between lists.
+*/
+
+/* ================================================================ */
+
+/* Element ordered by its key, `id` tells the list it came from and its position there */
+struct item {
+    int key;
+
+    int id;
+};
+
+/* ================================================================ */
+
+static inline struct item* new_item(int key, int id) {
+    struct item* item = (struct item*) malloc(sizeof(struct item));
+
+    item->key = key;
+
+    item->id = id;
+
+    return item;
+}
+
+static inline int item_order(const Data data_1, const Data data_2) {
+    return (((struct item*) data_1)->key > ((struct item*) data_2)->key) - (((struct item*) data_1)->key < ((struct item*) data_2)->key);
+}
+
+static inline int item_match(const Data data_1, const Data data_2) {
+    return ((struct item*) data_1)->id != ((struct item*) data_2)->id;
+}
+
+static inline size_t item_hash(const Data data) {
+    return (size_t) ((struct item*) data)->id;
+}
+
+/* ================================================================ */
+
+/**
+ * Make a list of n items with keys first, first + step, ... and ids base, base + 1, ...
+*/
+static inline List_t make(int first, int step, int base, size_t n) {
+    List_t list = List_create(free, NULL, item_match);
+
+    for (size_t i = 0; i < n; i++) {
+        List_insert_last(list, new_item(first + (int) i * step, base + (int) i));
+    }
+
+    return list;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that size, tail, index and skip list levels agree with the node chain.
+ *
+ * @return number of nodes in the chain.
+*/
+static inline size_t check_list(const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    Node_t node = NULL;
+
+    Node_t last = NULL;
+
+    /* Nodes the index holds for the data of a node */
+    void* items[4];
+
+    size_t found = 0;
+
+    size_t count = 0;
+
+    /* ================================ */
+
+
+
+    for (node = list->head; node != NULL; last = node, node = node->next, count++) {
+
+        if (list->index != NULL) {
+            found = Index_find(list->index, node->data, list->match, items, 4);
+
+            CHECK((found == 1) && (items[0] == node));
+        }
+
+        if (list->skip != NULL) {
+            CHECK(List_at(list, count) == node);
+        }
+    }
+
+    CHECK(count == list->size);
+
+    CHECK(list->tail == last);
+
+    CHECK((list->head == NULL) == (list->size == 0));
+
+    /* ================================ */
+
+    return count;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that keys of the list go in the order, ids of equal keys in increasing order (stability).
+*/
+static inline void check_sorted(const List_t list) {
+    struct item* prev = NULL;
+
+    struct item* item = NULL;
+
+    for (Node_t node = list->head; node != NULL; node = node->next, prev = item) {
+        item = (struct item*) node->data;
+
+        CHECK((prev == NULL) || (prev->key < item->key) || ((prev->key == item->key) && (prev->id < item->id)));
+    }
+}
+
+/* ================================================================ */
+
+/**
+ * Check that the list holds the ids in this order.
+*/
+static inline void check_ids(const List_t list, const int* ids, size_t n) {
+    size_t i = 0;
+
+    for (Node_t node = list->head; (node != NULL) && (i < n); node = node->next, i++) {
+        CHECK(((struct item*) node->data)->id == ids[i]);
+    }
+
+    CHECK((i == n) && (list->size == n));
+}
+
+/* ================================================================ */
+
+#endif
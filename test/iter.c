@@ -0,0 +1,180 @@
+#include "../src/list.h"
+#include "check.h"
+
+/* Number of elements in the longer lists, more than the traversal prefetches ahead */
+#define NUM 1000
+
+/* ================================================================ */
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+/* Data handed out by a traversal, in the order it was handed out */
+struct seen {
+    Data data[NUM + 2];
+
+    size_t count;
+};
+
+void record(Data data, void* arg) {
+    struct seen* seen = (struct seen*) arg;
+
+    if (seen->count < NUM + 2) {
+        seen->data[seen->count] = data;
+    }
+
+    seen->count++;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that the iterator and List_for_each hand out the data of every node once, in list order.
+*/
+static void check_traversal(const List_t list) {
+    /* =========== VARIABLES ========== */
+
+    struct _list_iterator iter;
+
+    struct seen seen = { { NULL }, 0 };
+
+    Data data = NULL;
+
+    Node_t node = list->head;
+
+    /* ================================ */
+
+
+
+    CHECK(List_iter_init(&iter, list) == 0);
+
+    for (; List_iter_next(&iter, &data) == 0; node = node->next) {
+        CHECK((node != NULL) && (node->data == data));
+
+        if (node == NULL) {
+            return ;
+        }
+    }
+
+    CHECK(node == NULL);
+
+    /* The end stays the end */
+    CHECK(List_iter_next(&iter, &data) != 0);
+
+    CHECK(List_for_each(list, record, &seen) == 0);
+
+    CHECK(seen.count == list->size);
+
+    node = list->head;
+
+    for (size_t i = 0; (i < seen.count) && (node != NULL); i++, node = node->next) {
+        CHECK(seen.data[i] == node->data);
+    }
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, NULL);
+
+    struct _list_iterator iter;
+
+    struct seen seen = { { NULL }, 0 };
+
+    Data data = NULL;
+
+    /* ================================ */
+
+
+
+    CHECK(List_iter_init(NULL, list) != 0);
+
+    CHECK(List_iter_init(&iter, NULL) != 0);
+
+    CHECK(List_for_each(NULL, record, &seen) != 0);
+
+    CHECK(List_for_each(list, NULL, NULL) != 0);
+
+    /* ========================= Empty list =========================== */
+    CHECK(List_iter_init(&iter, list) == 0);
+
+    CHECK(List_iter_next(&iter, NULL) != 0);
+
+    CHECK(List_iter_next(&iter, &data) != 0);
+
+    CHECK((List_for_each(list, record, &seen) == 0) && (seen.count == 0));
+
+    /* ========================= One element ========================== */
+    CHECK(List_insert_last(list, new_int(1)) == 0);
+
+    check_traversal(list);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_long(void) {
+    /* =========== VARIABLES ========== */
+
+    /* Data is not owned by the list, so one int can be in several nodes */
+    List_t list = List_create(NULL, NULL, NULL);
+
+    static int values[3] = { 0, 1, 2 };
+
+    /* ================================ */
+
+
+
+    /* Equal values and the same data in many nodes, NULL data in between */
+    for (int i = 0; i < NUM; i++) {
+        CHECK(List_insert_last(list, (i % 5 == 0) ? NULL : &values[i % 3]) == 0);
+    }
+
+    check_traversal(list);
+
+    /* Iterators of a changed list start from the new head */
+    CHECK(List_remove_first(list) == 0);
+
+    CHECK(List_insert_last(list, &values[0]) == 0);
+
+    check_traversal(list);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_long();
+
+    /* ================================ */
+
+    return CHECK_RESULT("iter");
+}
+
+/* ================================================================ */
@@ -0,0 +1,177 @@
+#include "items.h"
+
+/* Number of source lists merged at once */
+#define SOURCES 4
+
+/* Number of elements in every list */
+#define NUM 50
+
+/* ================================================================ */
+
+static void test_merge_sorted_n(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t dest = NULL;
+
+    List_t src[SOURCES];
+
+    List_t dup[2];
+
+    /* ================================ */
+
+
+
+    /* Keys overlap between all lists, the list number is the thousands of the id */
+    dest = make(0, 2, 0, NUM);
+
+    for (size_t i = 0; i < SOURCES; i++) {
+        src[i] = make((int) i, (int) i + 1, 1000 * ((int) i + 1), NUM);
+    }
+
+    CHECK(List_index(dest, item_hash, 0) == 0);
+
+    CHECK(List_skip(dest, item_order) == 0);
+
+    /* Warm the skip list levels up, so the merge has to leave them stale */
+    CHECK(List_at(dest, NUM - 1) == dest->tail);
+
+    CHECK(List_merge_sorted_n(&dest, src, SOURCES, item_order) == 0);
+
+    for (size_t i = 0; i < SOURCES; i++) {
+        CHECK(src[i] == NULL);
+    }
+
+    CHECK(check_list(dest) == (SOURCES + 1) * NUM);
+
+    /* Equal keys go in the order of the lists, dest first, then in the order within a list */
+    check_sorted(dest);
+
+    /* =========== A list cannot take part in a merge twice =========== */
+    dup[0] = make(0, 1, 0, 3);
+
+    dup[1] = dup[0];
+
+    CHECK(List_merge_sorted_n(&dest, dup, 2, item_order) != 0);
+
+    CHECK(List_merge_sorted_n(&dest, &dest, 1, item_order) != 0);
+
+    CHECK((dup[0] != NULL) && (check_list(dup[0]) == 3));
+
+    CHECK(check_list(dest) == (SOURCES + 1) * NUM);
+
+    List_destroy(&dup[0]);
+
+    List_destroy(&dest);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_merge_sorted(void) {
+    List_t dest = make(0, 3, 0, NUM);
+
+    List_t src = make(0, 2, 1000, NUM);
+
+    CHECK(List_merge_sorted(&dest, &src, item_order) == 0);
+
+    CHECK(src == NULL);
+
+    CHECK(check_list(dest) == 2 * NUM);
+
+    check_sorted(dest);
+
+    List_destroy(&dest);
+}
+
+/* ================================================================ */
+
+/**
+ * Fill a list with n items with keys first, first + step, ... and ids base, base + 1, ...
+*/
+static List_t fill(List_t list, int first, int step, int base, size_t n) {
+
+    for (size_t i = 0; i < n; i++) {
+        List_insert_last(list, new_item(first + (int) i * step, base + (int) i));
+    }
+
+    return list;
+}
+
+/* ================================================================ */
+
+static void test_merge_sorted_pools(void) {
+    /* =========== VARIABLES ========== */
+
+    Pool_t pool = Pool_create(sizeof(struct _node), 0);
+
+    List_t dest = NULL;
+
+    List_t src[3];
+
+    List_t empty = NULL;
+
+    /* ================================ */
+
+
+
+    dest = fill(List_create_pooled(free, NULL, item_match, pool), 0, 3, 0, NUM);
+
+    /* Nodes of a plain list and of a private pool are copied, nodes of the shared pool are relinked */
+    src[0] = make(1, 3, 1000, NUM);
+
+    src[1] = fill(List_create_pooled(free, NULL, item_match, pool), 2, 3, 2000, NUM);
+
+    src[2] = fill(List_create_pooled(free, NULL, item_match, NULL), 0, 2, 3000, NUM);
+
+    empty = List_create_pooled(free, NULL, item_match, NULL);
+
+    CHECK(List_index(dest, item_hash, 0) == 0);
+
+    CHECK(pool->refs == 3);
+
+    CHECK(List_merge_sorted_n(&dest, src, 3, item_order) == 0);
+
+    CHECK((src[0] == NULL) && (src[1] == NULL) && (src[2] == NULL));
+
+    CHECK(pool->refs == 2);
+
+    CHECK(check_list(dest) == 4 * NUM);
+
+    check_sorted(dest);
+
+    /* An empty list of another pool brings nothing */
+    CHECK(List_merge_sorted(&dest, &empty, item_order) == 0);
+
+    CHECK((empty == NULL) && (check_list(dest) == 4 * NUM));
+
+    /* Copied data is destroyed once, with dest */
+    List_destroy(&dest);
+
+    CHECK(pool->refs == 1);
+
+    CHECK(Pool_destroy(&pool) == 0);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_merge_sorted_n();
+
+    test_merge_sorted();
+
+    test_merge_sorted_pools();
+
+    /* ================================ */
+
+    return CHECK_RESULT("merge");
+}
+
+/* ================================================================ */
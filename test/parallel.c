@@ -0,0 +1,263 @@
+#include "../src/parallel/parallel.h"
+#include "check.h"
+
+#include <stdatomic.h>
+
+/* Number of elements, long enough to be split into several segments */
+#define NUM (4 * PARALLEL_MIN_SEGMENT + 7)
+
+/* Number of distinct values, every value is in the list many times */
+#define VALUES 1000
+
+/* Nodes found at most by one find_all call */
+#define MAX_FOUND 16
+
+/* ================================================================ */
+
+/* Match ints, NULL data only matches NULL data */
+int int_match(const Data data_1, const Data data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return data_1 != data_2;
+    }
+
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+/* Visits, visits of NULL data and the sum of ints, from all threads */
+struct visits {
+    atomic_size_t all;
+
+    atomic_size_t null;
+
+    atomic_long sum;
+};
+
+void count_visit(Data data, void* arg) {
+    struct visits* visits = (struct visits*) arg;
+
+    atomic_fetch_add(&visits->all, 1);
+
+    if (data == NULL) {
+        atomic_fetch_add(&visits->null, 1);
+    }
+    else {
+        atomic_fetch_add(&visits->sum, *((int*) data));
+    }
+}
+
+/* Sum of ints and number of NULL data */
+struct sum {
+    long sum;
+
+    size_t null;
+};
+
+void sum_reduce(void* acc, const Data data) {
+
+    if (data == NULL) {
+        ((struct sum*) acc)->null++;
+    }
+    else {
+        ((struct sum*) acc)->sum += *((int*) data);
+    }
+}
+
+void sum_combine(void* acc, const void* part) {
+    ((struct sum*) acc)->sum += ((const struct sum*) part)->sum;
+
+    ((struct sum*) acc)->null += ((const struct sum*) part)->null;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that parallel lookups of the value give what sequential lookups give, with any number of threads.
+*/
+static void check_find(const List_t list, int value) {
+    /* =========== VARIABLES ========== */
+
+    Node_t expected[MAX_FOUND];
+
+    Node_t found[MAX_FOUND];
+
+    size_t total = List_find_all(list, &value, NULL, expected, MAX_FOUND);
+
+    size_t threads[] = { 1, 2, 3, 8, 0 };
+
+    /* ================================ */
+
+
+
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        CHECK(List_parallel_find(list, &value, NULL, threads[t]) == List_find(list, &value, NULL));
+
+        CHECK(List_parallel_find_all(list, &value, NULL, found, MAX_FOUND, threads[t]) == total);
+
+        for (size_t i = 0; (i < total) && (i < MAX_FOUND); i++) {
+            CHECK(found[i] == expected[i]);
+        }
+
+        /* Counting only */
+        CHECK(List_parallel_find_all(list, &value, NULL, NULL, 0, threads[t]) == total);
+    }
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, int_match);
+
+    struct visits visits = { 0, 0, 0 };
+
+    struct sum sum = { 0, 0 };
+
+    int key = 1;
+
+    Node_t found[1] = { NULL };
+
+    /* ================================ */
+
+
+
+    /* ========================= Empty list =========================== */
+    CHECK(List_parallel_find(list, &key, NULL, 4) == NULL);
+
+    CHECK(List_parallel_find_all(list, &key, NULL, found, 1, 4) == 0);
+
+    CHECK(List_parallel_for_each(list, count_visit, &visits, 4) == 0);
+
+    CHECK(atomic_load(&visits.all) == 0);
+
+    /* The result is left as the identity value */
+    CHECK((List_parallel_reduce(list, sum_reduce, sum_combine, &sum, sizeof(struct sum), 4) == 0) && (sum.sum == 0) && (sum.null == 0));
+
+    CHECK(List_parallel_for_each(list, NULL, NULL, 4) != 0);
+
+    CHECK(List_parallel_reduce(list, sum_reduce, sum_combine, NULL, sizeof(struct sum), 4) != 0);
+
+    /* ========================= One element ========================== */
+    CHECK(List_insert_last(list, new_int(1)) == 0);
+
+    CHECK(List_parallel_find(list, &key, NULL, 4) == list->head);
+
+    CHECK((List_parallel_find_all(list, &key, NULL, found, 1, 4) == 1) && (found[0] == list->head));
+
+    CHECK((List_parallel_for_each(list, count_visit, &visits, 4) == 0) && (atomic_load(&visits.all) == 1));
+
+    CHECK((List_parallel_reduce(list, sum_reduce, sum_combine, &sum, sizeof(struct sum), 4) == 0) && (sum.sum == 1));
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_segments(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, int_match);
+
+    struct visits visits = { 0, 0, 0 };
+
+    struct sum sum = { 0, 0 };
+
+    long expected = 0;
+
+    size_t nulls = 0;
+
+    int key = -1;
+
+    /* ================================ */
+
+
+
+    /* Every value many times over, NULL data here and there */
+    for (int i = 0; i < NUM; i++) {
+
+        if (i % 97 == 3) {
+            CHECK(List_insert_last(list, NULL) == 0);
+
+            nulls++;
+        }
+        else {
+            CHECK(List_insert_last(list, new_int(i % VALUES)) == 0);
+
+            expected += i % VALUES;
+        }
+    }
+
+    /* ========== Duplicates: the ones closest to the head ============ */
+    for (int value = 0; value < VALUES; value += 111) {
+        check_find(list, value);
+    }
+
+    check_find(list, VALUES);
+
+    /* NULL data is never searched */
+    CHECK(List_parallel_find(list, NULL, NULL, 4) == NULL);
+
+    CHECK(List_parallel_find_all(list, NULL, NULL, NULL, 0, 4) == 0);
+
+    /* Every node is visited once, NULL data included */
+    CHECK(List_parallel_for_each(list, count_visit, &visits, 0) == 0);
+
+    CHECK((atomic_load(&visits.all) == NUM) && (atomic_load(&visits.null) == nulls) && (atomic_load(&visits.sum) == expected));
+
+    CHECK(List_parallel_reduce(list, sum_reduce, sum_combine, &sum, sizeof(struct sum), 0) == 0);
+
+    CHECK((sum.sum == expected) && (sum.null == nulls));
+
+    /* ============ Segments are recorded again after changes ========= */
+    CHECK(List_insert_last(list, new_int(-1)) == 0);
+
+    CHECK(List_parallel_find(list, &key, NULL, 4) == list->tail);
+
+    CHECK(List_insert_first(list, new_int(-1)) == 0);
+
+    check_find(list, -1);
+
+    CHECK(List_remove_first(list) == 0);
+
+    check_find(list, -1);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_segments();
+
+    /* ================================ */
+
+    return CHECK_RESULT("parallel");
+}
+
+/* ================================================================ */
@@ -0,0 +1,222 @@
+#include "../src/list.h"
+#include "check.h"
+
+/* Number of elements in every list */
+#define NUM 1000
+
+/* ================================================================ */
+
+int int_match(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that the list holds first, first + 1, ... and its size and tail agree.
+*/
+static void check_values(const List_t list, int first) {
+    size_t i = 0;
+
+    Node_t last = NULL;
+
+    for (Node_t node = list->head; node != NULL; last = node, node = node->next, i++) {
+        CHECK(*((int*) node->data) == first + (int) i);
+    }
+
+    CHECK((i == list->size) && (list->tail == last));
+}
+
+/* ================================================================ */
+
+static void test_reserve(void) {
+    /* =========== VARIABLES ========== */
+
+    Pool_t pool = Pool_create(24, 8);
+
+    char* items[NUM];
+
+    char* item = NULL;
+
+    /* ================================ */
+
+
+
+    CHECK((pool != NULL) && (pool->refs == 1) && (pool->item_size == 32));
+
+    /* A few items from a small chunk, then more reserved than the chunk holds */
+    for (size_t i = 0; i < 3; i++) {
+        items[i] = (char*) Pool_alloc(pool);
+    }
+
+    CHECK(Pool_reserve(pool, NUM) == 0);
+
+    for (size_t i = 0; i < NUM; i++) {
+        items[i] = (char*) Pool_alloc_reserved(pool);
+
+        CHECK((i == 0) || (items[i] == items[i - 1] + pool->item_size));
+    }
+
+    /* The rest of the small chunk was not lost, it is handed out again */
+    item = (char*) Pool_alloc(pool);
+
+    CHECK((item != NULL) && ((item < items[0]) || (item > items[NUM - 1])));
+
+    /* A reservation the current chunk can hold takes no new chunk */
+    CHECK(Pool_reserve(pool, 4) == 0);
+
+    for (size_t i = 0; i < 4; i++) {
+        items[i] = (char*) Pool_alloc_reserved(pool);
+
+        CHECK((i == 0) || (items[i] == items[i - 1] + pool->item_size));
+    }
+
+    /* ========== Clearing releases everything, the pool goes on ====== */
+    Pool_clear(pool);
+
+    CHECK((pool->chunks == NULL) && (pool->free == NULL) && (pool->refs == 1));
+
+    CHECK(Pool_alloc(pool) != NULL);
+
+    CHECK(Pool_destroy(&pool) == 0);
+
+    CHECK(pool == NULL);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_shared(void) {
+    /* =========== VARIABLES ========== */
+
+    Pool_t pool = Pool_create(sizeof(struct _node), 0);
+
+    List_t a = NULL;
+
+    List_t b = NULL;
+
+    Data data[NUM];
+
+    /* ================================ */
+
+
+
+    a = List_create_pooled(free, NULL, int_match, pool);
+
+    b = List_create_pooled(free, NULL, int_match, pool);
+
+    CHECK((a != NULL) && (b != NULL) && (pool->refs == 3));
+
+    for (int i = 0; i < NUM; i++) {
+        List_insert_last(a, new_int(i));
+
+        data[i] = new_int(NUM + i);
+    }
+
+    /* Bulk inserts reserve their nodes in one run */
+    CHECK(List_insert_last_n(b, data, NUM) == 0);
+
+    check_values(a, 0);
+
+    check_values(b, NUM);
+
+    /* ======= A shared pool is not cleared when one list is ========== */
+    CHECK(List_clear(a) == 0);
+
+    CHECK((a->size == 0) && (pool->chunks != NULL) && (pool->refs == 3));
+
+    check_values(b, NUM);
+
+    for (int i = 0; i < NUM; i++) {
+        List_insert_first(a, new_int(NUM - 1 - i));
+    }
+
+    check_values(a, 0);
+
+    /* ======= Nor when one of the lists goes away ==================== */
+    CHECK(List_destroy(&a) == 0);
+
+    CHECK(pool->refs == 2);
+
+    check_values(b, NUM);
+
+    CHECK(List_remove_first(b) == 0);
+
+    check_values(b, NUM + 1);
+
+    /* ===== Merged lists give their pool reference up ================ */
+    a = List_create_pooled(free, NULL, int_match, pool);
+
+    CHECK(List_insert_last(a, new_int(2 * NUM)) == 0);
+
+    CHECK(pool->refs == 3);
+
+    CHECK(List_merge(&b, &a) == 0);
+
+    CHECK((a == NULL) && (pool->refs == 2));
+
+    check_values(b, NUM + 1);
+
+    CHECK(List_destroy(&b) == 0);
+
+    CHECK(pool->refs == 1);
+
+    CHECK(Pool_destroy(&pool) == 0);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_private(void) {
+    List_t list = List_create_pooled(free, NULL, int_match, NULL);
+
+    CHECK((list != NULL) && (list->pool != NULL) && (list->pool->refs == 1));
+
+    for (int i = 0; i < NUM; i++) {
+        List_insert_last(list, new_int(i));
+    }
+
+    /* The only owner releases all nodes with the pool chunks at once */
+    CHECK(List_clear(list) == 0);
+
+    CHECK((list->size == 0) && (list->head == NULL) && (list->tail == NULL) && (list->pool->chunks == NULL));
+
+    for (int i = 0; i < NUM; i++) {
+        List_insert_last(list, new_int(i));
+    }
+
+    check_values(list, 0);
+
+    CHECK(List_destroy(&list) == 0);
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_reserve();
+
+    test_shared();
+
+    test_private();
+
+    /* ================================ */
+
+    return CHECK_RESULT("pool");
+}
+
+/* ================================================================ */
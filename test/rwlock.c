@@ -0,0 +1,171 @@
+#include "../src/list.h"
+#include "check.h"
+
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/* Number of reader threads */
+#define READERS 4
+
+/* Number of elements the writer appends */
+#define NUM 5000
+
+/* Number of lookups of every reader */
+#define READS 20000
+
+/* ================================================================ */
+
+static List_t list = NULL;
+
+/* Number of elements appended so far, element k holds the value k */
+static atomic_size_t published;
+
+/* Number of readers that have started, the writer waits for all of them */
+static atomic_size_t started;
+
+/* ================================================================ */
+
+int int_order(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) > *((int*) data_2)) - (*((int*) data_1) < *((int*) data_2));
+}
+
+/* ================================================================ */
+
+static void* write_list(void* arg) {
+    int* x = NULL;
+
+    (void) arg;
+
+    while (atomic_load(&started) < READERS) {
+        sched_yield();
+    }
+
+    for (size_t i = 0; i < NUM; i++) {
+        x = (int*) malloc(sizeof(int));
+
+        *x = (int) i;
+
+        /* Every append makes the skip list levels stale, so readers have to rebuild them */
+        CHECK(List_insert_last(list, x) == 0);
+
+        atomic_store(&published, i + 1);
+
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+static void* read_list(void* arg) {
+    /* xorshift state of the reader */
+    uint64_t seed = (uint64_t) (uintptr_t) arg * 0x9E3779B97F4A7C15ULL + 1;
+
+    size_t count = 0;
+
+    size_t k = 0;
+
+    int key = 0;
+
+    Node_t node = NULL;
+
+    atomic_fetch_add(&started, 1);
+
+    for (size_t reads = 0; reads < READS; reads++) {
+
+        /* Let the writer in between the lookups even on a single CPU */
+        sched_yield();
+
+        if ((count = atomic_load(&published)) == 0) {
+            continue ;
+        }
+
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        k = (size_t) (seed % count);
+
+        /* Either lookup may be the one to find the levels stale and rebuild them */
+        if (reads % 2 == 0) {
+            node = List_at(list, k);
+        }
+        /* The order of the skip list levels answers the lookup */
+        else {
+            key = (int) k;
+
+            node = List_find(list, &key, int_order);
+        }
+
+        /* Nodes are never removed here, so they can be read after the lock is released */
+        CHECK((node != NULL) && (*((int*) node->data) == (int) k));
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int main(void) {
+    /* =========== VARIABLES ========== */
+
+    pthread_t writer;
+
+    pthread_t readers[READERS];
+
+    int key = 0;
+
+    /* ================================ */
+
+
+
+    list = List_create_concurrent(free, NULL, int_order);
+
+    CHECK(list != NULL);
+
+    CHECK(List_skip(list, NULL) == 0);
+
+    atomic_init(&published, 0);
+
+    atomic_init(&started, 0);
+
+    /* ======= Readers trade the read lock for the write lock ========= */
+    pthread_create(&writer, NULL, write_list, NULL);
+
+    for (size_t i = 0; i < READERS; i++) {
+        pthread_create(&readers[i], NULL, read_list, (void*) (uintptr_t) i);
+    }
+
+    pthread_join(writer, NULL);
+
+    for (size_t i = 0; i < READERS; i++) {
+        pthread_join(readers[i], NULL);
+    }
+
+    /* ============= The final list is whole and in order ============= */
+    CHECK(list->size == NUM);
+
+    for (size_t k = 0; k < NUM; k += 97) {
+        CHECK(*((int*) List_at(list, k)->data) == (int) k);
+
+        key = (int) k;
+
+        CHECK(List_find(list, &key, NULL) == List_at(list, k));
+    }
+
+    CHECK(List_at(list, NUM) == NULL);
+
+    key = NUM;
+
+    CHECK(List_find(list, &key, NULL) == NULL);
+
+    CHECK(List_destroy(&list) == 0);
+
+    /* ================================ */
+
+    return CHECK_RESULT("rwlock");
+}
+
+/* ================================================================ */
@@ -0,0 +1,175 @@
+#include "../src/list.h"
+#include "check.h"
+
+/* Number of elements, enough for several levels of towers */
+#define NUM 2000
+
+/* ================================================================ */
+
+int int_order(const Data data_1, const Data data_2) {
+    return (*((int*) data_1) > *((int*) data_2)) - (*((int*) data_1) < *((int*) data_2));
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+/**
+ * Check every position of the list against a walk over the nodes.
+*/
+static void check_positions(const List_t list) {
+    size_t i = 0;
+
+    for (Node_t node = list->head; node != NULL; node = node->next, i++) {
+        CHECK(List_at(list, i) == node);
+    }
+
+    CHECK(i == list->size);
+
+    CHECK(List_at(list, list->size) == NULL);
+
+    /* List_at has brought the levels up to date */
+    CHECK(list->skip->changes == list->changes);
+}
+
+/* ================================================================ */
+
+/**
+ * Check that every value of the list is found where it is.
+*/
+static void check_lookups(const List_t list) {
+    int missing = -1;
+
+    for (Node_t node = list->head; node != NULL; node = node->next) {
+        CHECK(*((int*) List_find(list, node->data, int_order)->data) == *((int*) node->data));
+    }
+
+    CHECK(List_find(list, &missing, int_order) == NULL);
+}
+
+/* ================================================================ */
+
+int main(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, int_order);
+
+    struct _list_cursor cursor;
+
+    int key = 0;
+
+    size_t changes = 0;
+
+    /* ================================ */
+
+
+
+    /* Even values, sorted */
+    for (int i = 0; i < NUM; i++) {
+        List_insert_last(list, new_int(2 * i));
+    }
+
+    CHECK(List_skip(list, NULL) == 0);
+
+    CHECK(list->skip->height > 1);
+
+    check_positions(list);
+
+    check_lookups(list);
+
+    /* ========== Sorted inserts keep the levels up to date =========== */
+    for (int i = NUM - 1; i >= 0; i -= 7) {
+        changes = list->changes;
+
+        CHECK(List_insert_sorted(list, new_int(2 * i + 1), NULL) == 0);
+
+        CHECK((list->changes != changes) && (list->skip->changes == list->changes));
+    }
+
+    check_positions(list);
+
+    check_lookups(list);
+
+    /* Equal data goes after the nodes equal to it */
+    key = 10;
+
+    CHECK(List_insert_sorted(list, new_int(10), NULL) == 0);
+
+    CHECK(List_find(list, &key, NULL)->next->data != NULL);
+
+    CHECK(*((int*) List_find(list, &key, NULL)->next->data) == 10);
+
+    /* ============== Other changes leave the levels stale ============ */
+    changes = list->changes;
+
+    CHECK(List_remove_first(list) == 0);
+
+    CHECK(List_remove_last(list) == 0);
+
+    CHECK(List_remove_node(list, List_at(list, list->size / 2)) == 0);
+
+    CHECK(list->skip->changes != list->changes);
+
+    check_positions(list);
+
+    check_lookups(list);
+
+    /* ============= Lookups still work on an unsorted list =========== */
+    CHECK(List_insert_first(list, new_int(3 * NUM)) == 0);
+
+    List_cursor_init(&cursor, list);
+
+    for (size_t i = 0; i < list->size / 3; i++) {
+        List_cursor_next(&cursor);
+    }
+
+    CHECK(List_cursor_insert_before(&cursor, new_int(-5)) == 0);
+
+    check_positions(list);
+
+    CHECK(list->skip->sorted == 0);
+
+    check_lookups(list);
+
+    key = -5;
+
+    CHECK(*((int*) List_find(list, &key, NULL)->data) == -5);
+
+    /* ============ Sorting makes the levels answer lookups again ===== */
+    CHECK(List_sort(list, int_order) == 0);
+
+    check_positions(list);
+
+    CHECK(list->skip->sorted != 0);
+
+    check_lookups(list);
+
+    /* ================ Empty list and detaching ====================== */
+    CHECK(List_clear(list) == 0);
+
+    CHECK(List_at(list, 0) == NULL);
+
+    CHECK(List_insert_sorted(list, new_int(1), NULL) == 0);
+
+    check_positions(list);
+
+    CHECK(List_unskip(list) == 0);
+
+    CHECK(list->skip == NULL);
+
+    CHECK(*((int*) List_at(list, 0)->data) == 1);
+
+    CHECK(List_destroy(&list) == 0);
+
+    /* ================================ */
+
+    return CHECK_RESULT("skip");
+}
+
+/* ================================================================ */
@@ -0,0 +1,192 @@
+#include "items.h"
+
+/* Number of elements in the longer lists, not a power of two so the last run is short */
+#define NUM 1000
+
+/* ================================================================ */
+
+/* Order items by key, NULL data before everything else */
+int null_order(const Data data_1, const Data data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return (data_1 != NULL) - (data_2 != NULL);
+    }
+
+    return item_order(data_1, data_2);
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, NULL);
+
+    const int one[] = { 0 };
+
+    /* ================================ */
+
+
+
+    CHECK(List_sort(NULL, item_order) != 0);
+
+    /* There is nothing to order by */
+    CHECK(List_sort(list, NULL) != 0);
+
+    /* ========================= Empty list =========================== */
+    CHECK(List_sort(list, item_order) == 0);
+
+    CHECK(check_list(list) == 0);
+
+    /* ========================= One element ========================== */
+    CHECK(List_insert_last(list, new_item(5, 0)) == 0);
+
+    CHECK(List_sort(list, item_order) == 0);
+
+    check_ids(list, one, 1);
+
+    CHECK((check_list(list) == 1) && (list->head == list->tail));
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_orders(void) {
+    /* =========== VARIABLES ========== */
+
+    /* Already sorted, reversed, and two sorted halves one after the other */
+    List_t lists[3] = { make(0, 1, 0, NUM), make(NUM, -1, 0, NUM), make(0, 2, 0, NUM) };
+
+    /* ================================ */
+
+
+
+    for (int i = 0; i < NUM / 2; i++) {
+        List_insert_last(lists[2], new_item(2 * i + 1, NUM + i));
+    }
+
+    for (size_t i = 0; i < 3; i++) {
+        CHECK(List_sort(lists[i], item_order) == 0);
+
+        check_sorted(lists[i]);
+
+        CHECK(check_list(lists[i]) == lists[i]->size);
+
+        /* The tail is the last node, appending goes on working */
+        CHECK(List_insert_last(lists[i], new_item(2 * NUM, 2 * NUM)) == 0);
+
+        check_sorted(lists[i]);
+
+        List_destroy(&lists[i]);
+    }
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, item_match);
+
+    unsigned int seed = 7;
+
+    /* ================================ */
+
+
+
+    /* Few distinct keys, ids tell the order they were inserted in */
+    for (int i = 0; i < NUM; i++) {
+        seed = seed * 1103515245u + 12345u;
+
+        CHECK(List_insert_last(list, new_item((int) ((seed >> 16) % 8), i)) == 0);
+    }
+
+    CHECK(List_index(list, item_hash, 0) == 0);
+
+    CHECK(List_skip(list, item_order) == 0);
+
+    /* Equal keys keep their order, the index and the skip levels follow the new order */
+    CHECK(List_sort(list, item_order) == 0);
+
+    check_sorted(list);
+
+    CHECK(check_list(list) == NUM);
+
+    /* Sorting a sorted list changes nothing */
+    CHECK(List_sort(list, item_order) == 0);
+
+    check_sorted(list);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = List_create(free, NULL, NULL);
+
+    Node_t node = NULL;
+
+    size_t i = 0;
+
+    /* ================================ */
+
+
+
+    for (int j = 0; j < 10; j++) {
+        CHECK(List_insert_first(list, (j % 3 == 0) ? NULL : new_item(j, j)) == 0);
+    }
+
+    /* A comparison that knows NULL data puts it first */
+    CHECK(List_sort(list, null_order) == 0);
+
+    for (node = list->head; (node != NULL) && (node->data == NULL); node = node->next, i++) ;
+
+    CHECK(i == 4);
+
+    for (; node != NULL; node = node->next) {
+        CHECK((node->data != NULL) && ((node->next == NULL) || (item_order(node->data, node->next->data) < 0)));
+    }
+
+    CHECK(check_list(list) == 10);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_orders();
+
+    test_duplicates();
+
+    test_null_data();
+
+    /* ================================ */
+
+    return CHECK_RESULT("sort");
+}
+
+/* ================================================================ */
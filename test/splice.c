@@ -0,0 +1,211 @@
+#include "items.h"
+
+/* Number of elements in every list */
+#define NUM 50
+
+/* ================================================================ */
+
+static void test_merge_sorted_keep(void) {
+    List_t dest = make(0, 3, 0, NUM);
+
+    List_t src = make(1, 3, 2000, NUM);
+
+    /* Keeping the source alive leaves it empty and usable */
+    CHECK(List_merge_sorted_keep(dest, src, item_order) == 0);
+
+    CHECK((check_list(src) == 0) && (src->tail == NULL));
+
+    CHECK(check_list(dest) == 2 * NUM);
+
+    check_sorted(dest);
+
+    CHECK(List_insert_last(src, new_item(0, 3000)) == 0);
+
+    CHECK(check_list(src) == 1);
+
+    List_destroy(&src);
+
+    List_destroy(&dest);
+}
+
+/* ================================================================ */
+
+static void test_split_at(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t list = make(0, 1, 0, 10);
+
+    List_t rest = NULL;
+
+    List_t all = NULL;
+
+    const int head_ids[] = { 0, 1, 2, 3 };
+
+    const int rest_ids[] = { 4, 5, 6, 7, 8, 9 };
+
+    void* items[1];
+
+    /* ================================ */
+
+
+
+    CHECK(List_index(list, item_hash, 0) == 0);
+
+    CHECK(List_skip(list, item_order) == 0);
+
+    rest = List_split_at(list, List_at(list, 3));
+
+    CHECK(rest != NULL);
+
+    check_ids(list, head_ids, 4);
+
+    check_ids(rest, rest_ids, 6);
+
+    CHECK(check_list(list) == 4);
+
+    CHECK(check_list(rest) == 6);
+
+    /* Moved nodes leave the index of the list for the index of the new list, made the same way */
+    for (Node_t node = rest->head; node != NULL; node = node->next) {
+        CHECK(Index_find(list->index, node->data, list->match, items, 1) == 0);
+
+        CHECK(List_find(rest, node->data, NULL) == node);
+    }
+
+    CHECK((rest->index != NULL) && (rest->index->hash == list->index->hash));
+
+    CHECK((rest->skip != NULL) && (rest->skip->order == list->skip->order));
+
+    CHECK(((struct item*) List_find(rest, List_at(rest, 2)->data, item_order)->data)->id == 6);
+
+    /* Both lists go on working */
+    CHECK(List_insert_last(list, new_item(100, 100)) == 0);
+
+    CHECK(List_insert_last(rest, new_item(101, 101)) == 0);
+
+    CHECK((check_list(list) == 5) && (check_list(rest) == 7));
+
+    /* ==================== NULL moves all nodes ====================== */
+    all = List_split_at(list, NULL);
+
+    CHECK((all != NULL) && (check_list(all) == 5));
+
+    CHECK(check_list(list) == 0);
+
+    List_destroy(&all);
+
+    List_destroy(&rest);
+
+    List_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_splice(void) {
+    /* =========== VARIABLES ========== */
+
+    List_t dest = make(0, 1, 100, 5);
+
+    List_t src = make(0, 1, 0, 10);
+
+    List_t empty = make(0, 1, 200, 0);
+
+    List_t other = List_create_pooled(free, NULL, item_match, NULL);
+
+    const int dest_ids[] = { 100, 101, 3, 4, 5, 102, 103, 104 };
+
+    const int src_ids[] = { 0, 1, 2, 6, 7, 8, 9 };
+
+    const int tail_ids[] = { 8, 9, 100, 101, 3, 4, 5, 102, 103, 104 };
+
+    const int left_ids[] = { 0, 1, 2, 6, 7 };
+
+    /* ================================ */
+
+
+
+    CHECK(List_index(dest, item_hash, 0) == 0);
+
+    CHECK(List_index(src, item_hash, 0) == 0);
+
+    CHECK(List_skip(dest, item_order) == 0);
+
+    /* ======== A range from the middle into the middle =============== */
+    CHECK(List_splice(dest, List_at(dest, 1), src, List_at(src, 2), List_at(src, 5)) == 0);
+
+    check_ids(dest, dest_ids, 8);
+
+    check_ids(src, src_ids, 7);
+
+    CHECK((check_list(dest) == 8) && (check_list(src) == 7));
+
+    /* ========= The tail of src before the head of dest ============== */
+    CHECK(List_splice(dest, NULL, src, List_at(src, 4), NULL) == 0);
+
+    check_ids(dest, tail_ids, 10);
+
+    check_ids(src, left_ids, 5);
+
+    CHECK((check_list(dest) == 10) && (check_list(src) == 5));
+
+    /* ========= Ranges that do not end with the last node ============ */
+    CHECK(List_splice(dest, NULL, src, List_at(src, 3), List_at(src, 1)) != 0);
+
+    CHECK(List_splice(dest, NULL, src, src->tail, NULL) != 0);
+
+    check_ids(src, left_ids, 5);
+
+    /* ================ Nodes of different pools ====================== */
+    CHECK(List_splice(other, NULL, src, NULL, NULL) != 0);
+
+    CHECK((check_list(src) == 5) && (check_list(other) == 0));
+
+    /* ================ All of src into an empty list ================= */
+    CHECK(List_splice(empty, NULL, src, NULL, NULL) == 0);
+
+    check_ids(empty, left_ids, 5);
+
+    CHECK((check_list(empty) == 5) && (check_list(src) == 0));
+
+    CHECK((src->head == NULL) && (src->tail == NULL));
+
+    /* ==================== And on after the tail ===================== */
+    CHECK(List_splice(dest, dest->tail, empty, NULL, NULL) == 0);
+
+    CHECK((check_list(dest) == 15) && (check_list(empty) == 0));
+
+    CHECK(((struct item*) dest->tail->data)->id == 7);
+
+    List_destroy(&empty);
+
+    List_destroy(&other);
+
+    List_destroy(&src);
+
+    List_destroy(&dest);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_merge_sorted_keep();
+
+    test_split_at();
+
+    test_splice();
+
+    /* ================================ */
+
+    return CHECK_RESULT("splice");
+}
+
+/* ================================================================ */
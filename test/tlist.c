@@ -0,0 +1,314 @@
+#include "../src/tlist/tlist.h"
+#include "check.h"
+
+#include <string.h>
+
+/* Number of elements in the longer lists */
+#define NUM 100
+
+/* ================================================================ */
+
+/* Strings match by content, NULL only matches NULL */
+#define STR_EQ(a, b) ((((a) == NULL) || ((b) == NULL)) ? ((a) == (b)) : (strcmp((a), (b)) == 0))
+
+/* Number of strings handed over to the destroy function */
+static size_t destroyed = 0;
+
+static void str_destroy(char* s) {
+    destroyed++;
+
+    free(s);
+}
+
+static char* new_str(const char* value) {
+    char* s = (char*) malloc(strlen(value) + 1);
+
+    strcpy(s, value);
+
+    return s;
+}
+
+/* A value bigger than a pointer, copied into nodes as a whole */
+struct point {
+    int x;
+
+    int y;
+
+    int z;
+};
+
+#define POINT_EQ(a, b) (((a).x == (b).x) && ((a).y == (b).y) && ((a).z == (b).z))
+
+TLIST_DEFINE(IntList, int, TLIST_EQ, TLIST_NO_DESTROY)
+
+TLIST_DEFINE(StrList, char*, STR_EQ, str_destroy)
+
+TLIST_DEFINE(PointList, struct point, POINT_EQ, TLIST_NO_DESTROY)
+
+/* ================================================================ */
+
+/**
+ * Check that the list holds the ints in this order and that its size and tail agree with its links.
+*/
+static void check_ints(const IntList_t list, const int* values, size_t n) {
+    struct IntList_node* node = NULL;
+
+    struct IntList_node* last = NULL;
+
+    size_t i = 0;
+
+    TLIST_FOREACH(list, node) {
+        CHECK((i < n) && (node->value == values[i]));
+
+        last = node;
+
+        i++;
+    }
+
+    CHECK((i == n) && (list->size == n) && (list->tail == last));
+}
+
+/* ================================================================ */
+
+static void test_edges(void) {
+    /* =========== VARIABLES ========== */
+
+    IntList_t list = IntList_create();
+
+    int value = 0;
+
+    const int one[] = { 1 };
+
+    /* ================================ */
+
+
+
+    CHECK(IntList_insert_last(NULL, 1) != 0);
+
+    CHECK(IntList_find(NULL, 1) == NULL);
+
+    CHECK(IntList_destroy(NULL) != 0);
+
+    /* ========================= Empty list =========================== */
+    check_ints(list, NULL, 0);
+
+    CHECK(IntList_find(list, 1) == NULL);
+
+    CHECK(IntList_remove_first(list, &value) != 0);
+
+    CHECK(IntList_remove(list, 1) != 0);
+
+    /* ========================= One element ========================== */
+    CHECK(IntList_insert_last(list, 1) == 0);
+
+    check_ints(list, one, 1);
+
+    CHECK((IntList_find(list, 1) == &list->head->value) && (list->head == list->tail));
+
+    CHECK((IntList_remove_first(list, &value) == 0) && (value == 1));
+
+    check_ints(list, NULL, 0);
+
+    CHECK(IntList_insert_first(list, 1) == 0);
+
+    check_ints(list, one, 1);
+
+    CHECK(IntList_remove(list, 1) == 0);
+
+    CHECK((list->head == NULL) && (list->tail == NULL));
+
+    /* ===== The emptied list goes on working ========================= */
+    CHECK(IntList_insert_first(list, 1) == 0);
+
+    check_ints(list, one, 1);
+
+    CHECK(IntList_destroy(&list) == 0);
+
+    CHECK(list == NULL);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(void) {
+    /* =========== VARIABLES ========== */
+
+    IntList_t list = IntList_create();
+
+    int values[NUM];
+
+    size_t n = 0;
+
+    /* ================================ */
+
+
+
+    /* Values 0, 1, 2 over and over at both ends, the head is a 1 */
+    for (int i = 0; i < NUM / 2; i++) {
+        CHECK(IntList_insert_last(list, i % 3) == 0);
+
+        CHECK(IntList_insert_first(list, i % 3) == 0);
+    }
+
+    /* The one closest to the head is found and removed */
+    CHECK(IntList_find(list, 1) == &list->head->value);
+
+    CHECK(IntList_remove(list, 1) == 0);
+
+    CHECK(*IntList_find(list, 1) == 1);
+
+    CHECK(IntList_find(list, 3) == NULL);
+
+    /* Every 1 goes, the tail is kept right */
+    while (IntList_remove(list, 1) == 0) ;
+
+    CHECK(IntList_find(list, 1) == NULL);
+
+    for (int i = NUM / 2 - 1; i >= 0; i--) {
+
+        if (i % 3 != 1) {
+            values[n++] = i % 3;
+        }
+    }
+
+    for (int i = 0; i < NUM / 2; i++) {
+
+        if (i % 3 != 1) {
+            values[n++] = i % 3;
+        }
+    }
+
+    check_ints(list, values, n);
+
+    CHECK(IntList_insert_last(list, 5) == 0);
+
+    CHECK(list->tail->value == 5);
+
+    IntList_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    StrList_t list = StrList_create();
+
+    char* value = NULL;
+
+    /* ================================ */
+
+
+
+    destroyed = 0;
+
+    /* NULL is a value like any other */
+    CHECK(StrList_insert_last(list, NULL) == 0);
+
+    CHECK(StrList_insert_last(list, new_str("a")) == 0);
+
+    CHECK(StrList_insert_last(list, NULL) == 0);
+
+    CHECK(StrList_insert_first(list, new_str("b")) == 0);
+
+    CHECK(StrList_find(list, NULL) == &list->head->next->value);
+
+    CHECK(strcmp(*StrList_find(list, "a"), "a") == 0);
+
+    CHECK(StrList_find(list, "c") == NULL);
+
+    /* Removed values are destroyed unless they are handed over */
+    CHECK(StrList_remove(list, NULL) == 0);
+
+    CHECK(StrList_find(list, NULL) == &list->tail->value);
+
+    CHECK((StrList_remove_first(list, &value) == 0) && (strcmp(value, "b") == 0));
+
+    free(value);
+
+    CHECK(StrList_remove_first(list, NULL) == 0);
+
+    CHECK((list->size == 1) && (destroyed == 2));
+
+    CHECK(StrList_destroy(&list) == 0);
+
+    CHECK(destroyed == 3);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_struct_values(void) {
+    /* =========== VARIABLES ========== */
+
+    PointList_t list = PointList_create();
+
+    struct point point = { 1, 2, 3 };
+
+    struct point* found = NULL;
+
+    /* ================================ */
+
+
+
+    /* Values are copied in, the original may change afterwards */
+    CHECK(PointList_insert_last(list, point) == 0);
+
+    point.z = 4;
+
+    CHECK(PointList_insert_last(list, point) == 0);
+
+    CHECK(PointList_find(list, point) == &list->tail->value);
+
+    point.z = 3;
+
+    found = PointList_find(list, point);
+
+    CHECK((found == &list->head->value) && (found->x == 1) && (found->z == 3));
+
+    /* Stored values can be changed in place */
+    found->z = 4;
+
+    CHECK(PointList_find(list, point) == NULL);
+
+    point.z = 4;
+
+    CHECK((PointList_remove(list, point) == 0) && (list->size == 1));
+
+    CHECK((PointList_remove_first(list, &point) == 0) && (point.z == 4));
+
+    PointList_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    test_edges();
+
+    test_duplicates();
+
+    test_null_data();
+
+    test_struct_values();
+
+    /* ================================ */
+
+    return CHECK_RESULT("tlist");
+}
+
+/* ================================================================ */
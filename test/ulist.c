@@ -0,0 +1,506 @@
+#include "../src/ulist/ulist.h"
+#include "check.h"
+
+#include <limits.h>
+#include <string.h>
+
+/* Number of elements, enough for many blocks */
+#define NUM 1000
+
+/* ================================================================ */
+
+/* Match ints, NULL data only matches NULL data */
+int int_match(const Data data_1, const Data data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return data_1 != data_2;
+    }
+
+    return (*((int*) data_1) - *((int*) data_2));
+}
+
+static int* new_int(int value) {
+    int* x = (int*) malloc(sizeof(int));
+
+    *x = value;
+
+    return x;
+}
+
+/* ================================================================ */
+
+/* The content the list must have, -1 stands for NULL data */
+static int model[2 * NUM + 2];
+
+static size_t model_size = 0;
+
+static void model_insert(size_t i, int value) {
+    memmove(&model[i + 1], &model[i], (model_size - i) * sizeof(int));
+
+    model[i] = value;
+
+    model_size++;
+}
+
+static void model_remove(size_t i) {
+    memmove(&model[i], &model[i + 1], (model_size - i - 1) * sizeof(int));
+
+    model_size--;
+}
+
+/* ================================================================ */
+
+/**
+ * Check that blocks are linked both ways, none is empty, counts add up to the size, keys agree with data,
+ * and the list holds what the model holds.
+*/
+static void check_list(const UList_t list) {
+    /* =========== VARIABLES ========== */
+
+    UBlock_t block = NULL;
+
+    UBlock_t last = NULL;
+
+    size_t blocks = 0;
+
+    size_t i = 0;
+
+    /* ================================ */
+
+
+
+    for (block = list->head; block != NULL; last = block, block = block->next, blocks++) {
+        CHECK(block->prev == last);
+
+        CHECK((block->count > 0) && (block->count <= ULIST_SLOTS));
+
+        for (size_t slot = 0; slot < block->count; slot++, i++) {
+            CHECK(i < model_size);
+
+            if (i < model_size) {
+                CHECK((model[i] < 0) ? (block->slots[slot] == NULL) : ((block->slots[slot] != NULL) && (*((int*) block->slots[slot]) == model[i])));
+            }
+
+            if (list->find_key != NULL) {
+                CHECK(block->keys[slot] == *((int*) block->slots[slot]));
+            }
+        }
+    }
+
+    CHECK((i == list->size) && (i == model_size));
+
+    CHECK((blocks == list->blocks) && (list->tail == last));
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_edges(UList_t list) {
+    int key = 1;
+
+    model_size = 0;
+
+    /* ========================= Empty list =========================== */
+    check_list(list);
+
+    CHECK(UList_find(list, &key, NULL) == NULL);
+
+    CHECK(UList_find_int(list, 1) == NULL);
+
+    CHECK(UList_remove_first(list) != 0);
+
+    CHECK(UList_remove_last(list) != 0);
+
+    CHECK(UList_remove(list, &key, NULL) != 0);
+
+    /* ========================= One element ========================== */
+    CHECK(UList_insert_last(list, new_int(1)) == 0);
+
+    model_insert(0, 1);
+
+    check_list(list);
+
+    CHECK(*((int*) UList_find(list, &key, NULL)) == 1);
+
+    CHECK(UList_remove_last(list) == 0);
+
+    model_remove(0);
+
+    check_list(list);
+
+    CHECK((list->head == NULL) && (list->tail == NULL) && (list->blocks == 0));
+
+    /* ===== The emptied list goes on working ========================= */
+    CHECK(UList_insert_first(list, new_int(1)) == 0);
+
+    model_insert(0, 1);
+
+    CHECK(UList_remove(list, &key, NULL) == 0);
+
+    model_remove(0);
+
+    check_list(list);
+}
+
+/* ================================================================ */
+
+static void test_blocks(UList_t list) {
+    /* =========== VARIABLES ========== */
+
+    int key = 0;
+
+    /* ================================ */
+
+
+
+    model_size = 0;
+
+    /* Both ends grow, full blocks spill into new ones */
+    for (int i = 0; i < NUM; i++) {
+
+        if (i % 3 == 0) {
+            CHECK(UList_insert_first(list, new_int(i)) == 0);
+
+            model_insert(0, i);
+        }
+        else {
+            CHECK(UList_insert_last(list, new_int(i)) == 0);
+
+            model_insert(model_size, i);
+        }
+    }
+
+    check_list(list);
+
+    CHECK(list->blocks >= NUM / ULIST_SLOTS);
+
+    /* Removals from the middle leave blocks half empty, neighbours are merged */
+    for (int i = 1; i < NUM; i += 2) {
+        key = i;
+
+        CHECK(UList_remove(list, &key, NULL) == 0);
+
+        for (size_t j = 0; j < model_size; j++) {
+
+            if (model[j] == i) {
+                model_remove(j);
+
+                break ;
+            }
+        }
+    }
+
+    check_list(list);
+
+    CHECK(list->blocks <= (model_size + ULIST_SLOTS / 2 - 1) / (ULIST_SLOTS / 2) + 1);
+
+    /* Both ends shrink */
+    for (size_t i = 0; i < NUM / 8; i++) {
+        CHECK(UList_remove_first(list) == 0);
+
+        model_remove(0);
+
+        CHECK(UList_remove_last(list) == 0);
+
+        model_remove(model_size - 1);
+    }
+
+    check_list(list);
+
+    /* Every value left is found, removed ones are not */
+    for (size_t i = 0; i < model_size; i++) {
+        CHECK(*((int*) UList_find(list, &model[i], NULL)) == model[i]);
+    }
+
+    key = 1;
+
+    CHECK(UList_find(list, &key, NULL) == NULL);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_duplicates(UList_t list) {
+    /* =========== VARIABLES ========== */
+
+    int* first = new_int(5);
+
+    int key = 5;
+
+    /* ================================ */
+
+
+
+    model_size = 0;
+
+    /* One 5 in every block, the second one is `first` */
+    for (int i = 0; i < 3 * ULIST_SLOTS; i++) {
+        CHECK(UList_insert_last(list, (i == ULIST_SLOTS + 1) ? first : new_int((i % ULIST_SLOTS == 1) ? 5 : i + 100)) == 0);
+
+        model_insert(model_size, (i % ULIST_SLOTS == 1) ? 5 : i + 100);
+    }
+
+    /* The first occurrence is found and removed */
+    CHECK(UList_find(list, &key, NULL) != first);
+
+    CHECK(UList_remove(list, &key, NULL) == 0);
+
+    model_remove(1);
+
+    CHECK(UList_find(list, &key, NULL) == first);
+
+    CHECK(UList_remove(list, &key, NULL) == 0);
+
+    model_remove(ULIST_SLOTS);
+
+    check_list(list);
+
+    CHECK(UList_remove(list, &key, NULL) == 0);
+
+    model_remove(2 * ULIST_SLOTS - 1);
+
+    CHECK(UList_find(list, &key, NULL) == NULL);
+
+    check_list(list);
+}
+
+/* ================================================================ */
+
+/**
+ * Check that UList_find_int returns the first data equal to the key, as a walk over the model finds it.
+*/
+static void check_find_int(const UList_t list, int key) {
+    /* =========== VARIABLES ========== */
+
+    Data data = UList_find_int(list, key);
+
+    /* ================================ */
+
+
+
+    for (UBlock_t block = list->head; block != NULL; block = block->next) {
+
+        for (size_t slot = 0; slot < block->count; slot++) {
+
+            if ((block->slots[slot] != NULL) && (*((int*) block->slots[slot]) == key)) {
+                CHECK(data == block->slots[slot]);
+
+                return ;
+            }
+        }
+    }
+
+    CHECK(data == NULL);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_find_int(UList_t list) {
+    /* =========== VARIABLES ========== */
+
+    int* first = NULL;
+
+    /* ================================ */
+
+
+
+    model_size = 0;
+
+    /* ========================= Empty list =========================== */
+    CHECK(UList_find_int(list, 0) == NULL);
+
+    CHECK(UList_find_int(NULL, 0) == NULL);
+
+    /* ========================= One element ========================== */
+    CHECK(UList_insert_last(list, new_int(INT_MIN)) == 0);
+
+    CHECK(*((int*) UList_find_int(list, INT_MIN)) == INT_MIN);
+
+    CHECK(UList_find_int(list, 0) == NULL);
+
+    CHECK(UList_remove_first(list) == 0);
+
+    /* Keys at both ends of every block, in full blocks and in the last one, which is not full */
+    for (int i = 0; i < 3 * ULIST_SLOTS + 2; i++) {
+        CHECK(UList_insert_last(list, new_int(i)) == 0);
+    }
+
+    for (int key = -1; key <= 3 * ULIST_SLOTS + 2; key++) {
+        check_find_int(list, key);
+    }
+
+    /* ========= Duplicates: the one closest to the head is found ===== */
+    first = new_int(ULIST_SLOTS);
+
+    CHECK(UList_insert_first(list, first) == 0);
+
+    CHECK(UList_insert_last(list, new_int(INT_MAX)) == 0);
+
+    CHECK(UList_insert_last(list, new_int(INT_MAX)) == 0);
+
+    CHECK(UList_find_int(list, ULIST_SLOTS) == first);
+
+    check_find_int(list, INT_MAX);
+
+    /* Once it is gone the next one is found, removals move keys between blocks */
+    CHECK(UList_remove(list, first, NULL) == 0);
+
+    check_find_int(list, ULIST_SLOTS);
+
+    for (int i = 0; i < 3 * ULIST_SLOTS; i += 2) {
+        CHECK(UList_remove(list, &i, NULL) == 0);
+    }
+
+    for (int key = -1; key <= 3 * ULIST_SLOTS + 2; key++) {
+        check_find_int(list, key);
+    }
+
+    check_find_int(list, INT_MAX);
+
+    /* ============ Plain lists pass over NULL data =================== */
+    if (list->find_key == NULL) {
+        CHECK(UList_insert_first(list, NULL) == 0);
+
+        CHECK(UList_insert_last(list, NULL) == 0);
+
+        check_find_int(list, 1);
+
+        check_find_int(list, INT_MAX);
+
+        check_find_int(list, 0);
+    }
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+static void test_null_data(void) {
+    /* =========== VARIABLES ========== */
+
+    UList_t list = UList_create(free, NULL, int_match);
+
+    UList_t keyed = UList_create_int(free, NULL, int_match);
+
+    int key = 2;
+
+    /* ================================ */
+
+
+
+    model_size = 0;
+
+    /* Plain lists hold NULL data like any other */
+    for (int i = 0; i < 2 * ULIST_SLOTS; i++) {
+        CHECK(UList_insert_last(list, (i % 4 == 0) ? NULL : new_int(i)) == 0);
+
+        model_insert(model_size, (i % 4 == 0) ? -1 : i);
+    }
+
+    CHECK(UList_insert_first(list, NULL) == 0);
+
+    model_insert(0, -1);
+
+    check_list(list);
+
+    CHECK(UList_find(list, NULL, NULL) == NULL);
+
+    CHECK(*((int*) UList_find(list, &key, NULL)) == 2);
+
+    CHECK(UList_remove(list, NULL, NULL) != 0);
+
+    CHECK(UList_remove_first(list) == 0);
+
+    model_remove(0);
+
+    CHECK(UList_remove_first(list) == 0);
+
+    model_remove(0);
+
+    check_list(list);
+
+    /* Lists of int keys refuse data without a key */
+    CHECK(UList_insert_last(keyed, NULL) != 0);
+
+    CHECK(UList_insert_first(keyed, NULL) != 0);
+
+    CHECK((keyed->size == 0) && (keyed->head == NULL));
+
+    UList_destroy(&keyed);
+
+    UList_destroy(&list);
+
+    /* ================================ */
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(void) {
+    /* =========== VARIABLES ========== */
+
+    UList_t lists[2];
+
+    /* ================================ */
+
+
+
+    lists[0] = UList_create(free, NULL, int_match);
+
+    lists[1] = UList_create_int(free, NULL, int_match);
+
+    /* Plain lists and lists of int keys keep the same content */
+    for (size_t i = 0; i < 2; i++) {
+
+        test_edges(lists[i]);
+
+        test_blocks(lists[i]);
+
+        UList_destroy(&lists[i]);
+
+        CHECK(lists[i] == NULL);
+    }
+
+    lists[0] = UList_create(free, NULL, int_match);
+
+    lists[1] = UList_create_int(free, NULL, int_match);
+
+    for (size_t i = 0; i < 2; i++) {
+
+        test_duplicates(lists[i]);
+
+        UList_destroy(&lists[i]);
+    }
+
+    lists[0] = UList_create(free, NULL, int_match);
+
+    lists[1] = UList_create_int(free, NULL, int_match);
+
+    for (size_t i = 0; i < 2; i++) {
+
+        test_find_int(lists[i]);
+
+        UList_destroy(&lists[i]);
+    }
+
+    test_null_data();
+
+    /* ================================ */
+
+    return CHECK_RESULT("ulist");
+}
+
+/* ================================================================ */